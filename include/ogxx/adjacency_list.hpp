@@ -7,6 +7,8 @@
 #include <ogxx/st_set.hpp>
 #include <ogxx/graph_view.hpp>
 
+#include <span>
+
 
 /// Root namespace of the OGxx library.
 namespace ogxx
@@ -91,6 +93,14 @@ namespace ogxx
     /// When removing vertices remove all edges incident with the removed vertices.
     /// @param new_vertex_count how many vertices the list should represent after this call (vertices have indices 0, 1, ..., new_vertex_count - 1)
     virtual void set_vertex_count(Scalar_size new_vertex_count) = 0;
+
+    /// @brief Get the adjacency of a vertex creating an empty one if the vertex has no adjacency yet.
+    /// Graph views call it to insert arrows. The default implementation sets a new sorted vector adjacency,
+    /// implementations managing their adjacency storage themselves override it.
+    /// @param vertex the index of the vertex, the list may grow to include it
+    /// @return the adjacency of the vertex owned by this list
+    virtual auto get_or_create_adjacency(Vertex_index vertex)
+      -> Adjacency&;
   };
 
 
@@ -104,12 +114,125 @@ namespace ogxx
   [[nodiscard]] auto new_adjacency_list_hashtable()
     -> Adjacency_list_uptr;
 
+  /// @brief Create an empty adjacency list based upon a vector of separately allocated adjacencies.
+  /// @return An owning pointer to an Adjacency_list_vector object.
+  [[nodiscard]] auto new_adjacency_list_vector()
+    -> Adjacency_list_uptr;
+
+  /// @brief Create an empty adjacency list based upon a vector of adjacencies allocated from one monotonic arena.
+  /// Adjacency objects and their items come from the arena owned by the list, so there is no allocator metadata per vertex,
+  /// and destruction or clear() release the whole arena at once. Memory of erased items is not reused until clear().
+  /// Adjacencies passed by set() are copied into the arena (and the passed objects are deleted).
+  /// @return An owning pointer to an Adjacency_list_vector object.
+  [[nodiscard]] auto new_adjacency_list_vector_arena()
+    -> Adjacency_list_uptr;
+
+
+  // Compressed sparse row (CSR) adjacency lists
+
+  /// @brief Create a read-only compressed sparse row (CSR) adjacency list containing the edges of a graph.
+  /// All the adjacencies are stored in one contiguous array (sorted, without duplicates) indexed by an offset array.
+  /// Both the arrays are filled by two passes over gv.iterate_edges(): counting vertex degrees, then placing the targets.
+  /// @param gv the source graph, each edge of an undirected graph is stored in both directions
+  /// @return an owning pointer to the adjacency list object, its modifiers throw std::logic_error
+  [[nodiscard]] auto new_adjacency_list_csr(Graph_view const& gv)
+    -> Adjacency_list_uptr;
+
+  /// @brief Create a read-only compressed sparse row (CSR) adjacency list containing the given arrows.
+  /// @param arrows       an iterator enumerating (from, to) vertex index pairs, duplicates are ignored
+  /// @param vertex_count the minimal vertex count (the actual one is enlarged to fit all the vertex indices occuring)
+  /// @return an owning pointer to the adjacency list object, its modifiers throw std::logic_error
+  [[nodiscard]] auto new_adjacency_list_csr(Vertex_pair_iterator_uptr arrows, Scalar_size vertex_count = 0)
+    -> Adjacency_list_uptr;
+
+
+  class Edge_list;
+
+  /// @brief Create a read-only CSR adjacency list of a directed graph storing in-adjacencies (CSC arrays) as well.
+  /// Its graph view iterates in-neighbors by a pointer walk just like out-neighbors.
+  /// The edges are read once, then CSR and CSC arrays are built concurrently.
+  /// @param gv the source graph, an undirected graph gets an ordinary CSR adjacency list (in-neighbors are the neighbors)
+  /// @return an owning pointer to the adjacency list object, its modifiers throw std::logic_error
+  [[nodiscard]] auto new_adjacency_list_bidirectional_csr(Graph_view const& gv)
+    -> Adjacency_list_uptr;
+
+  /// @brief Create a read-only CSR adjacency list of a directed graph storing in-adjacencies (CSC arrays) as well.
+  /// The edges are read once, then CSR and CSC arrays are built concurrently.
+  /// @param el the source edge list, its vertex count is el.max_vertex_index() + 1
+  /// @return an owning pointer to the adjacency list object, its modifiers throw std::logic_error
+  [[nodiscard]] auto new_adjacency_list_bidirectional_csr(Edge_list const& el)
+    -> Adjacency_list_uptr;
+
+
+  /// @brief Read-only view of the arrays of a compressed sparse row (CSR) adjacency list.
+  /// A default-constructed (empty) view means that the viewed object is not CSR-based.
+  struct Csr_view
+  {
+    /// @brief Neighbors of vertex v occupy targets[offsets[v]] ... targets[offsets[v + 1] - 1], offsets.size() == vertex count + 1.
+    std::span<Scalar_index const> offsets;
+    /// @brief Neighbor indices of all vertices, neighbors of each vertex are sorted.
+    std::span<Vertex_index const> targets;
+
+    /// @brief Check if the view refers to CSR arrays.
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+      return !offsets.empty();
+    }
+
+    /// @brief Get the count of vertices.
+    [[nodiscard]] auto vertex_count() const noexcept
+      -> Scalar_size
+    {
+      return offsets.empty()? 0: static_cast<Scalar_size>(offsets.size()) - 1;
+    }
+
+    /// @brief Get the count of neighbors of a vertex (valid index is required).
+    [[nodiscard]] auto degree(Vertex_index vertex) const noexcept
+      -> Scalar_size
+    {
+      return offsets[vertex + 1] - offsets[vertex];
+    }
+
+    /// @brief Get the sorted neighbors of a vertex (valid index is required).
+    [[nodiscard]] auto neighbors(Vertex_index vertex) const noexcept
+      -> std::span<Vertex_index const>
+    {
+      return targets.subspan(offsets[vertex], degree(vertex));
+    }
+  };
+
+  /// @brief Get the arrays of a CSR adjacency list.
+  /// @param al an adjacency list
+  /// @return the arrays of al if it has been created by new_adjacency_list_csr, empty view otherwise
+  [[nodiscard]] auto csr_view(Adjacency_list const& al) noexcept
+    -> Csr_view;
+
+  /// @brief Get the arrays of a CSR adjacency list under a graph view.
+  /// Algorithms may use it to walk neighbor arrays directly instead of calling iterate_neighbors.
+  /// @param gv a graph view
+  /// @return the arrays of the viewed adjacency list if gv is a graph view of a CSR adjacency list or a weighted graph view, empty view otherwise
+  [[nodiscard]] auto csr_view(Graph_view const& gv) noexcept
+    -> Csr_view;
+
+  /// @brief Get the in-adjacency (CSC) arrays of a bidirectional CSR adjacency list.
+  /// @param al an adjacency list
+  /// @return the arrays where "targets" are in-neighbors if al has been created by new_adjacency_list_bidirectional_csr, empty view otherwise
+  [[nodiscard]] auto csc_view(Adjacency_list const& al) noexcept
+    -> Csr_view;
+
+  /// @brief Get the in-adjacency (CSC) arrays of a bidirectional CSR adjacency list under a directed graph view.
+  /// @param gv a graph view
+  /// @return the arrays where "targets" are in-neighbors if gv is a directed graph view of a bidirectional CSR adjacency list, empty view otherwise
+  [[nodiscard]] auto csc_view(Graph_view const& gv) noexcept
+    -> Csr_view;
+
 
   /// @brief Directed graph facilities.
   namespace directed
   {
 
     /// @brief Create a read-only graph view for an adjacency list of a directed graph.
+    /// A CSR adjacency list gets a specialized view iterating neighbors by walking its arrays.
     /// @param al viewed adjacency list, must live while the result graph view is being used
     /// @return a graph view read-only object
     [[nodiscard]] auto graph_view(Adjacency_list const& al)
@@ -128,6 +251,8 @@ namespace ogxx
   {
 
     /// @brief Create a read-only graph view for an adjacency list of an undirected graph.
+    /// Each edge is to be stored in both directions: a -> b and b -> a.
+    /// A CSR adjacency list gets a specialized view iterating neighbors by walking its arrays.
     /// @param al viewed adjacency list, must live while the result graph view is being used
     /// @return a graph view read-only object
     [[nodiscard]] auto graph_view(Adjacency_list const& al)
@@ -0,0 +1,143 @@
+/// @file connected_components.hpp
+/// @brief Concurrent disjoint-set structure and parallel connected components.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_CONNECTED_COMPONENTS_HPP_INCLUDED
+#define OGXX_CONNECTED_COMPONENTS_HPP_INCLUDED
+
+#include <ogxx/graph_view.hpp>
+#include <ogxx/thread_pool.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief Disjoint sets of items 0, 1, ..., size() - 1 (union-find), lock-free:
+  /// find, unite and are_united may be called by many threads at once.
+  /// Each set is represented by its least item, unite links the root with the greater index to the other root
+  /// by compare-and-swap, find halves the path. An ingestion loop calling Graph_view::connect(u, v)
+  /// may call unite(u, v) too to keep the connectivity up to date.
+  class Concurrent_disjoint_set
+  {
+  public:
+    /// @brief Create size singleton sets.
+    explicit Concurrent_disjoint_set(Scalar_size size = 0)
+      : _parents(size)
+    {
+      std::iota(_parents.begin(), _parents.end(), Scalar_index{});
+    }
+
+    /// @brief Get the count of items.
+    [[nodiscard]] auto size() const noexcept
+      -> Scalar_size
+    {
+      return static_cast<Scalar_size>(_parents.size());
+    }
+
+    /// @brief Change the count of items, new items become singletons (not concurrently with other operations).
+    /// Shrinking is allowed only if no item left is united with a removed one.
+    void resize(Scalar_size new_size)
+    {
+      auto const old_size = size();
+      _parents.resize(new_size);
+      if (old_size < new_size)
+        std::iota(_parents.begin() + old_size, _parents.end(), old_size);
+    }
+
+    /// @brief Get the representative (the least item) of the set containing the item (valid index is required).
+    [[nodiscard]] auto find(Scalar_index item) noexcept
+      -> Scalar_index
+    {
+      for (;;)
+      {
+        auto const parent = load(item);
+        if (parent == item)
+          return item;
+
+        auto const grandparent = load(parent);
+        if (grandparent != parent)
+        {
+          // Path halving, losing the race to another thread is harmless.
+          auto expected = parent;
+          ref(item).compare_exchange_weak(expected, grandparent, std::memory_order_relaxed);
+        }
+
+        item = grandparent;
+      }
+    }
+
+    /// @brief Merge the sets containing two items (valid indices are required).
+    /// @return true if the sets have been merged, false if the items had been in the same set
+    auto unite(Scalar_index a, Scalar_index b) noexcept
+      -> bool
+    {
+      for (;;)
+      {
+        a = find(a);
+        b = find(b);
+        if (a == b)
+          return false;
+        if (a < b)
+          std::swap(a, b);
+
+        // a is the greater root, it may have been linked by another thread meanwhile.
+        auto expected = a;
+        if (ref(a).compare_exchange_weak(expected, b, std::memory_order_relaxed))
+          return true;
+      }
+    }
+
+    /// @brief Check if two items are in the same set. The answer may be outdated by concurrent unite calls,
+    /// but it is exact if the items have been united before the call.
+    [[nodiscard]] auto are_united(Scalar_index a, Scalar_index b) noexcept
+      -> bool
+    {
+      for (;;)
+      {
+        a = find(a);
+        b = find(b);
+        if (a == b)
+          return true;
+        // a is still a root: the sets were different at some moment during the call.
+        if (load(a) == a)
+          return false;
+      }
+    }
+
+  private:
+    std::vector<Scalar_index> _parents;
+
+    [[nodiscard]] auto ref(Scalar_index item) noexcept
+      -> std::atomic_ref<Scalar_index>
+    {
+      return std::atomic_ref<Scalar_index>(_parents[item]);
+    }
+
+    [[nodiscard]] auto load(Scalar_index item) noexcept
+      -> Scalar_index
+    {
+      return ref(item).load(std::memory_order_relaxed);
+    }
+  };
+
+
+  /// @brief            Find connected components in parallel (Afforest, Sutton et al.): the vertices are united
+  ///                   with their first two neighbors, the largest component is estimated by sampling,
+  ///                   then only the vertices outside it process their remaining arcs.
+  ///                   Arcs of a directed graph are taken as undirected edges (weakly connected components),
+  ///                   then no vertex is skipped. The arcs are walked through the CSR arrays (see csr_view),
+  ///                   other graph views are converted by new_adjacency_list_csr first.
+  /// @param graph      the edges
+  /// @param pool       threads to process the vertices
+  /// @return           component labels: the least vertex index of the component of each vertex,
+  ///                   so the count of components is the count of v such that labels[v] == v
+  [[nodiscard]] auto connected_components(Graph_view const& graph, Thread_pool& pool)
+    -> std::vector<Vertex_index>;
+
+}
+
+#endif//OGXX_CONNECTED_COMPONENTS_HPP_INCLUDED
@@ -0,0 +1,59 @@
+/// @file delta_stepping.hpp
+/// @brief Parallel delta-stepping single source shortest path algorithm.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_DELTA_STEPPING_HPP_INCLUDED
+#define OGXX_DELTA_STEPPING_HPP_INCLUDED
+
+#include <ogxx/weighted_graph_view.hpp>
+#include <ogxx/thread_pool.hpp>
+
+#include <span>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief            Compute the distances from the source to all the vertices by delta-stepping:
+  ///                   vertices are kept in buckets of width delta by their tentative distance, the least nonempty bucket
+  ///                   is emptied relaxing light arcs (weight <= delta) repeatedly, then heavy arcs of its vertices once.
+  ///                   The arcs of a bucket are relaxed in parallel.
+  /// Throws std::out_of_range for an invalid source, std::invalid_argument if a weight is negative
+  /// or distances is less than the vertex count.
+  /// @param graph      the arcs and their weights
+  /// @param source     the start vertex
+  /// @param distances  receives the distances, int_infinity for the unreachable vertices
+  /// @param pool       threads to relax the arcs
+  /// @param delta      bucket width, 0 chooses the maximal weight divided by the average out-degree
+  void delta_stepping(Int_weighted_graph_view const& graph, Vertex_index source,
+      std::span<Int> distances, Thread_pool& pool, Int delta = 0);
+
+  /// @brief            Compute the distances by delta-stepping, see the Int version.
+  /// @param distances  receives the distances, infinity for the unreachable vertices
+  void delta_stepping(Float_weighted_graph_view const& graph, Vertex_index source,
+      std::span<Float> distances, Thread_pool& pool, Float delta = 0);
+
+  /// @brief            Compute the distances by delta-stepping into a row of a matrix, see the span version.
+  /// Throws std::out_of_range if the row does not exist, std::invalid_argument if it is shorter than the vertex count.
+  void delta_stepping(Int_weighted_graph_view const& graph, Vertex_index source,
+      Int_matrix& distances, Scalar_index row, Thread_pool& pool, Int delta = 0);
+
+  /// @brief            Compute the distances by delta-stepping into a row of a matrix, see the span version.
+  void delta_stepping(Float_weighted_graph_view const& graph, Vertex_index source,
+      Float_matrix& distances, Scalar_index row, Thread_pool& pool, Float delta = 0);
+
+  /// @brief            Compute the distances by delta-stepping, see the span version.
+  /// @return           distances, int_infinity for the unreachable vertices
+  [[nodiscard]] auto delta_stepping(Int_weighted_graph_view const& graph, Vertex_index source,
+      Thread_pool& pool, Int delta = 0)
+    -> std::vector<Int>;
+
+  /// @brief            Compute the distances by delta-stepping, see the span version.
+  /// @return           distances, infinity for the unreachable vertices
+  [[nodiscard]] auto delta_stepping(Float_weighted_graph_view const& graph, Vertex_index source,
+      Thread_pool& pool, Float delta = 0)
+    -> std::vector<Float>;
+
+}
+
+#endif//OGXX_DELTA_STEPPING_HPP_INCLUDED
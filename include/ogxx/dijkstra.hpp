@@ -0,0 +1,104 @@
+/// @file dijkstra.hpp
+/// @brief Dijkstra's single source shortest path algorithm with a reusable workspace.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_DIJKSTRA_HPP_INCLUDED
+#define OGXX_DIJKSTRA_HPP_INCLUDED
+
+#include <ogxx/weighted_graph_view.hpp>
+
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief Priority queue used by Dijkstra's algorithm.
+  enum class Dijkstra_heap
+  {
+    automatic,  ///< radix for Int weights, d_ary for Float weights
+    d_ary,      ///< indexed 4-ary heap with decrease-key
+    radix,      ///< monotone radix heap, Int weights only
+  };
+
+
+  /// @brief Buffers of Dijkstra's algorithm reused by consecutive runs.
+  /// Buffers grow to the largest graph seen and are not cleared between runs (a run stamps the vertices it reaches),
+  /// so after the first runs a query makes no allocations and costs nothing for the vertices it does not reach.
+  /// A workspace is to be used by one thread at a time.
+  /// Weights must be non-negative, Int path lengths saturate at int_infinity ("no path").
+  /// @tparam Weight Int or Float
+  template <typename Weight>
+  class Dijkstra_workspace
+  {
+  public:
+    /// @brief Create an empty workspace.
+    /// Throws std::invalid_argument if the heap kind does not support the weight type.
+    explicit Dijkstra_workspace(Dijkstra_heap heap = Dijkstra_heap::automatic);
+
+    ~Dijkstra_workspace();
+    Dijkstra_workspace(Dijkstra_workspace&&) noexcept;
+    Dijkstra_workspace& operator=(Dijkstra_workspace&&) noexcept;
+
+    /// @brief The heap kind in use (automatic is resolved).
+    [[nodiscard]] auto heap() const noexcept
+      -> Dijkstra_heap;
+
+    /// @brief Compute shortest paths from the source, stop as soon as the target gets its final distance.
+    /// Throws std::out_of_range for an invalid source and std::invalid_argument if a negative weight is met.
+    /// @param graph  the arcs and their weights, must live while distance, parent and path are used
+    /// @param source the start vertex
+    /// @param target the vertex to stop at, npos to compute the paths to all the vertices
+    /// @return the distance from the source to the target, no_path_length<Weight> if it is unreachable or target is npos
+    auto run(Weighted_graph_view<Weight> const& graph, Vertex_index source, Vertex_index target = npos)
+      -> Weight;
+
+    /// @brief Get the distance found by the last run.
+    /// @return the final distance or no_path_length<Weight> if the vertex has not been settled (unreachable or the run stopped before)
+    [[nodiscard]] auto distance(Vertex_index vertex) const noexcept
+      -> Weight;
+
+    /// @brief Get the previous vertex of the shortest path found by the last run.
+    /// @return the parent vertex, npos for the source and the vertices without a final distance
+    [[nodiscard]] auto parent(Vertex_index vertex) const noexcept
+      -> Vertex_index;
+
+    /// @brief Get the shortest path found by the last run.
+    /// @param target the last vertex of the path
+    /// @param path   receives the vertices from the source to the target (cleared, its capacity is reused)
+    /// @return false and an empty path if the target has not been settled
+    auto path(Vertex_index target, std::vector<Vertex_index>& path) const
+      -> bool;
+
+  private:
+    struct State;
+    std::unique_ptr<State> _state;
+  };
+
+  extern template class Dijkstra_workspace<Int>;
+  extern template class Dijkstra_workspace<Float>;
+
+
+  /// @brief Compute the distances from the source to all the vertices.
+  /// @return distances, int_infinity for the unreachable vertices
+  [[nodiscard]] auto dijkstra(Int_weighted_graph_view const& graph, Vertex_index source)
+    -> std::vector<Int>;
+
+  /// @brief Compute the distances from the source to all the vertices.
+  /// @return distances, infinity for the unreachable vertices
+  [[nodiscard]] auto dijkstra(Float_weighted_graph_view const& graph, Vertex_index source)
+    -> std::vector<Float>;
+
+  /// @brief Compute a point-to-point distance using a workspace local to the calling thread.
+  /// Weights of a matrix or a callback are attached to a graph once by new_weighted_graph_view.
+  /// @return the distance, int_infinity if there is no path
+  [[nodiscard]] auto shortest_path_length(Int_weighted_graph_view const& graph, Vertex_index from, Vertex_index to)
+    -> Int;
+
+  /// @brief Compute a point-to-point distance using a workspace local to the calling thread.
+  /// @return the distance, infinity if there is no path
+  [[nodiscard]] auto shortest_path_length(Float_weighted_graph_view const& graph, Vertex_index from, Vertex_index to)
+    -> Float;
+
+}
+
+#endif//OGXX_DIJKSTRA_HPP_INCLUDED
@@ -1,23 +1,86 @@
 /// @file floyd_warshall.hpp
 /// @brief Floyd-Warshall algorithm for Int_matrix and Float_matrix
 /// @author Timahev R.E. 
-#ifndef OGXX_ST_MATRIX_IO_HPP_INCLUDED
-#define OGXX_ST_MATRIX_IO_HPP_INCLUDED
+#ifndef OGXX_FLOYD_WARSHALL_HPP_INCLUDED
+#define OGXX_FLOYD_WARSHALL_HPP_INCLUDED
 
 #include <ogxx/st_matrix.hpp>
+#include <ogxx/thread_pool.hpp>
+#include <ogxx/vertex_pair.hpp>
 
 namespace ogxx
 {
 
 /// @brief            Run integer Floyd-Warshall algorithm.
-/// @param distances  edge length matrix for a graph, must be square
+/// @param distances  edge length matrix for a graph, must be square, int_infinity means no edge (sums saturate)
 /// @return           shortest path distance matrix
 auto floyd_warshall_only_matrix(Int_matrix const& distances) -> Int_matrix_uptr;
 
 /// @brief            Run floating-point Floyd-Warshall algorithm.
-/// @param distances  edge length matrix for a graph, must be square
+/// @param distances  edge length matrix for a graph, must be square, infinity means no edge
 /// @return           shortest path distance matrix
 auto floyd_warshall_only_matrix(Float_matrix const& distances) -> Float_matrix_uptr;
+
+/// @brief            Run integer Floyd-Warshall algorithm on a thread pool (same result as the serial one).
+/// @param distances  edge length matrix for a graph, must be square, int_infinity means no edge (sums saturate)
+/// @param pool       threads to run independent tiles of each phase, e.g. default_thread_pool()
+/// @return           shortest path distance matrix
+auto floyd_warshall_only_matrix(Int_matrix const& distances, Thread_pool& pool) -> Int_matrix_uptr;
+
+/// @brief            Run floating-point Floyd-Warshall algorithm on a thread pool (same result as the serial one).
+/// @param distances  edge length matrix for a graph, must be square, infinity means no edge
+/// @param pool       threads to run independent tiles of each phase, e.g. default_thread_pool()
+/// @return           shortest path distance matrix
+auto floyd_warshall_only_matrix(Float_matrix const& distances, Thread_pool& pool) -> Float_matrix_uptr;
+
+
+/// @brief            Shortest path distances together with routes.
+template <typename ST>
+struct Shortest_paths
+{
+  St_matrix_uptr<ST>  distances;  ///< shortest path distance matrix
+  Int_matrix_uptr     next_hops;  ///< next_hops(i, j) is the vertex after i on a shortest path from i to j (j if i == j), npos if there is no path
+};
+
+/// @brief            Run integer Floyd-Warshall algorithm computing next hops in the same pass.
+/// @param distances  edge length matrix for a graph, must be square, int_infinity means no edge (sums saturate)
+/// @return           shortest path distance matrix and next hop matrix
+auto floyd_warshall(Int_matrix const& distances) -> Shortest_paths<Int>;
+
+/// @brief            Run floating-point Floyd-Warshall algorithm computing next hops in the same pass.
+/// @param distances  edge length matrix for a graph, must be square, infinity means no edge
+/// @return           shortest path distance matrix and next hop matrix
+auto floyd_warshall(Float_matrix const& distances) -> Shortest_paths<Float>;
+
+/// @brief            Run integer Floyd-Warshall algorithm computing next hops on a thread pool.
+auto floyd_warshall(Int_matrix const& distances, Thread_pool& pool) -> Shortest_paths<Int>;
+
+/// @brief            Run floating-point Floyd-Warshall algorithm computing next hops on a thread pool.
+auto floyd_warshall(Float_matrix const& distances, Thread_pool& pool) -> Shortest_paths<Float>;
+
+
+/// @brief            Walk a shortest path by a next hop matrix: from, ..., to (empty if there is no path).
+/// Does not allocate, takes O(1) per vertex. The next hop matrix must live while the iterator is being used.
+/// @code{.cpp}
+///     Path_iterator path(*paths.next_hops, from, to);
+///     for (Vertex_index v; path.next(v);)
+///       visit(v);
+/// @endcode
+class Path_iterator final
+  : public Basic_iterator<Vertex_index>
+{
+public:
+  Path_iterator(Int_matrix const& next_hops, Vertex_index from, Vertex_index to) noexcept;
+
+  auto next(Vertex_index& vertex) noexcept -> bool override;
+
+private:
+  Int_matrix const* _next_hops;
+  Vertex_index      _current;   ///< the vertex to be returned next, npos at the end
+  Vertex_index      _to;
+  Scalar_size       _hops_left; ///< guards against loops of a matrix with negative cycles
+};
+
 }
 
-#endif//OGXX_ST_MATRIX_IO_HPP_INCLUDED
\ No newline at end of file
+#endif//OGXX_FLOYD_WARSHALL_HPP_INCLUDED
\ No newline at end of file
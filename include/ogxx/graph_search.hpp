@@ -6,15 +6,48 @@
 #include <ogxx/iterable.hpp>
 #include <ogxx/st_set.hpp>
 #include <ogxx/graph_view.hpp>
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/iterator_algorithms.hpp>
+#include <ogxx/thread_pool.hpp>
+
+#include <bit>
+#include <random>
+#include <span>
+#include <vector>
 
 namespace ogxx
 {
- 
-  // Predeclaration.
-  class Graph_search_controller {};
+
+  /// @brief Receiver of graph search events. Each event returns true to go on or false to stop the search.
+  /// The default implementations do nothing and go on, so a controller overrides only the events it needs.
+  /// The search templates below accept any class with (some of) these member functions, the calls are inlined then.
+  class Graph_search_controller
+  {
+  public:
+    virtual ~Graph_search_controller() {}
+
+    /// @brief A vertex is visited for the first time and becomes open.
+    /// @param vertex the vertex reached
+    /// @param parent the vertex whose edge has led to vertex, npos for the start vertex
+    virtual auto discover_vertex(Vertex_index vertex, Vertex_index parent)
+      -> bool { (void)vertex; (void)parent; return true; }
+
+    /// @brief An edge of an open vertex is examined, it is reported before discovering its head.
+    /// @param from the vertex taken from the open vertex storage
+    /// @param to   its neighbor, visited or not
+    virtual auto examine_edge(Vertex_index from, Vertex_index to)
+      -> bool { (void)from; (void)to; return true; }
+
+    /// @brief All the edges of the vertex have been examined.
+    virtual auto finish_vertex(Vertex_index vertex)
+      -> bool { (void)vertex; return true; }
+  };
+
+  /// @brief Owning pointer to a graph search controller.
   using Graph_search_controller_uptr = std::unique_ptr<Graph_search_controller>;
 
-  /// @brief Generic unweighted graph search.
+  /// @brief Generic unweighted graph search: open vertices are taken from vertex_order one by one, their edges examined,
+  /// unvisited heads discovered and put to vertex_order. Nothing is searched if the start vertex is already visited.
   /// @param start_index        the vertex to start from
   /// @param graph              the graph on which we search (using iterate_neighbors method)
   /// @param visited_vertices   the storage for already visited vertices, it may be used to prohibit visiting certain vertices in ahead
@@ -30,7 +63,7 @@ namespace ogxx
   ) -> bool;
 
 
-  /// @brief Generic unweighted graph search.
+  /// @brief Generic unweighted graph search, see the version with visited_vertices, a bit vector is used for them.
   /// @param start_index        the vertex to start from
   /// @param graph              the graph on which we search (using iterate_neighbors method)
   /// @param vertex_order       the storage for open vertices, it defines the order of searching
@@ -122,6 +155,328 @@ namespace ogxx
   ) -> bool;
 
 
+  // Search templates: the controller calls are resolved at compile time,
+  // CSR graph views (see csr_view) are walked through their arrays, visited vertices are kept in a bit vector.
+
+  /// @brief Order of taking open vertices.
+  enum class Search_order
+  {
+    depth_first,    ///< the last put one (a stack)
+    breadth_first,  ///< the first put one (a queue)
+    random_first,   ///< a random one
+  };
+
+  /// @brief Unweighted graph search calling the controller directly.
+  /// Controller may have any of the member functions of Graph_search_controller (not necessarily virtual),
+  /// the events it lacks are not generated. Throws std::out_of_range for an invalid start vertex.
+  /// @tparam order             how to choose the next open vertex
+  /// @param start_index        the vertex to start from
+  /// @param graph              the graph on which we search
+  /// @param controller         the object receiving the events
+  /// @return true if the search has been finished by the controller, false if the search has been finished by exhaustion
+  template <Search_order order, typename Controller>
+  auto graph_search(Vertex_index start_index, Graph_view const& graph, Controller& controller)
+    -> bool
+  {
+    auto const n = graph.vertex_count();
+    if (start_index < 0 || n <= start_index)
+      throw std::out_of_range("graph_search: start vertex index out of range.");
+
+    std::vector<std::uint64_t> visited((n + 63) / 64);
+    auto const visit = [&visited](Vertex_index v)
+      {
+        auto& word = visited[v / 64];
+        auto const bit = std::uint64_t(1) << (v % 64);
+        auto const is_new = !(word & bit);
+        word |= bit;
+        return is_new;
+      };
+
+    auto const discover = [&controller](Vertex_index v, Vertex_index parent)
+      {
+        if constexpr (requires { controller.discover_vertex(v, parent); })
+          return bool(controller.discover_vertex(v, parent));
+        else
+          return true;
+      };
+
+    std::vector<Vertex_index> open;
+    Scalar_index              head = 0; // the queue front
+    std::default_random_engine random_engine;
+    if constexpr (order == Search_order::random_first)
+      random_engine.seed(std::random_device{}());
+
+    visit(start_index);
+    if (!discover(start_index, npos))
+      return true;
+    open.push_back(start_index);
+
+    bool is_stopped = false;
+    auto const examine = [&](Vertex_index from, Vertex_index to)
+      {
+        if constexpr (requires { controller.examine_edge(from, to); })
+          if (!controller.examine_edge(from, to))
+            return false;
+
+        if (visit(to))
+        {
+          if (!discover(to, from))
+            return false;
+          open.push_back(to);
+        }
+
+        return true;
+      };
+
+    auto const csr = csr_view(graph);
+    while (head < static_cast<Scalar_index>(open.size()))
+    {
+      Vertex_index u;
+      if constexpr (order == Search_order::breadth_first)
+      {
+        u = open[head++];
+      }
+      else
+      {
+        if constexpr (order == Search_order::random_first)
+        {
+          std::uniform_int_distribution<std::size_t> pick(0, open.size() - 1);
+          std::swap(open[pick(random_engine)], open.back());
+        }
+
+        u = open.back();
+        open.pop_back();
+      }
+
+      if (csr)
+      {
+        for (auto v: csr.neighbors(u))
+          if (!examine(u, v))
+            return true;
+      }
+      else
+      {
+        auto neighbors = graph.iterate_neighbors(u);
+        for_each_batch(*neighbors, [&](std::span<Vertex_index> batch)
+          {
+            for (auto v: batch)
+              if (!examine(u, v))
+                return !(is_stopped = true);
+            return true;
+          });
+
+        if (is_stopped)
+          return true;
+      }
+
+      if constexpr (requires { controller.finish_vertex(u); })
+        if (!controller.finish_vertex(u))
+          return true;
+    }
+
+    return false;
+  }
+
+  /// @brief Depth-first graph search calling the controller directly, see graph_search<order>.
+  template <typename Controller>
+  auto depth_first_search(Vertex_index start_index, Graph_view const& graph, Controller& controller)
+    -> bool
+  {
+    return graph_search<Search_order::depth_first>(start_index, graph, controller);
+  }
+
+  /// @brief Breadth-first graph search calling the controller directly, see graph_search<order>.
+  template <typename Controller>
+  auto breadth_first_search(Vertex_index start_index, Graph_view const& graph, Controller& controller)
+    -> bool
+  {
+    return graph_search<Search_order::breadth_first>(start_index, graph, controller);
+  }
+
+  /// @brief Random-first graph search calling the controller directly, see graph_search<order>.
+  template <typename Controller>
+  auto random_first_search(Vertex_index start_index, Graph_view const& graph, Controller& controller)
+    -> bool
+  {
+    return graph_search<Search_order::random_first>(start_index, graph, controller);
+  }
+
+
+  /// @brief Breadth-first search variants.
+  enum class Bfs_mode
+  {
+    top_down,             ///< expand the frontier through the out-edges of its vertices
+    direction_optimizing, ///< scan the in-edges of the unvisited vertices instead (bottom-up) while the frontier is large
+  };
+
+  /// @brief Direction-optimizing breadth-first search thresholds (Beamer et al.):
+  /// go bottom-up when the out-edges of the frontier exceed 1/alpha of the edges of the unvisited vertices,
+  /// go back top-down when the frontier is shrinking and less than 1/beta of the vertices.
+  constexpr Scalar_size bfs_alpha = 14;
+  constexpr Scalar_size bfs_beta  = 24;
+
+  /// @brief Breadth-first graph search calling the controller directly.
+  /// Bfs_mode::direction_optimizing needs the in-adjacency arrays: a CSR view of an undirected graph
+  /// or a directed graph view of new_adjacency_list_bidirectional_csr, other graphs are searched top-down.
+  /// In that mode vertices are still discovered level by level, each level in increasing index order when it is processed bottom-up,
+  /// but only discover_vertex events are generated. Frontiers processed bottom-up are bit vectors.
+  /// Throws std::out_of_range for an invalid start vertex.
+  /// @return true if the search has been finished by the controller, false if the search has been finished by exhaustion
+  template <typename Controller>
+  auto breadth_first_search(Vertex_index start_index, Graph_view const& graph, Controller& controller, Bfs_mode mode)
+    -> bool
+  {
+    auto const out = csr_view(graph);
+    auto const in  = graph.is_directed()? csc_view(graph): out;
+    if (mode == Bfs_mode::top_down || !out || !in)
+      return breadth_first_search(start_index, graph, controller);
+
+    auto const n = out.vertex_count();
+    if (start_index < 0 || n <= start_index)
+      throw std::out_of_range("breadth_first_search: start vertex index out of range.");
+
+    auto const discover = [&controller](Vertex_index v, Vertex_index parent)
+      {
+        if constexpr (requires { controller.discover_vertex(v, parent); })
+          return bool(controller.discover_vertex(v, parent));
+        else
+          return true;
+      };
+
+    using Word = std::uint64_t;
+    constexpr Scalar_size word_bits = 64;
+    auto const words = (n + word_bits - 1) / word_bits;
+    std::vector<Word> visited(words), frontier_bits, next_bits;
+    auto const bit_of = [](Vertex_index v) { return Word(1) << (v % word_bits); };
+
+    std::vector<Vertex_index> frontier, next;
+    visited[start_index / word_bits] |= bit_of(start_index);
+    if (!discover(start_index, npos))
+      return true;
+    frontier.push_back(start_index);
+
+    auto unexplored_arcs = static_cast<Scalar_size>(out.targets.size()) - out.degree(start_index);
+    auto frontier_arcs   = out.degree(start_index);
+    auto frontier_size   = Scalar_size(1);
+    bool is_bottom_up    = false;
+
+    while (frontier_size > 0)
+    {
+      if (!is_bottom_up && frontier_arcs > unexplored_arcs / bfs_alpha)
+      {
+        // Switch to bottom-up: frontier queue -> bits.
+        is_bottom_up = true;
+        frontier_bits.assign(words, 0);
+        for (auto v: frontier)
+          frontier_bits[v / word_bits] |= bit_of(v);
+      }
+
+      Scalar_size next_size = 0, next_arcs = 0;
+      if (is_bottom_up)
+      {
+        next_bits.assign(words, 0);
+        for (Scalar_index w = 0; w < words; ++w)
+        {
+          for (auto unvisited = ~visited[w]; unvisited; unvisited &= unvisited - 1)
+          {
+            auto const v = w * word_bits + std::countr_zero(unvisited);
+            if (v >= n)
+              break;
+
+            for (auto u: in.neighbors(v))
+            {
+              if (frontier_bits[u / word_bits] & bit_of(u))
+              {
+                visited[w] |= bit_of(v);
+                next_bits[w] |= bit_of(v);
+                if (!discover(v, u))
+                  return true;
+
+                ++next_size;
+                next_arcs += out.degree(v);
+                break;
+              }
+            }
+          }
+        }
+
+        frontier_bits.swap(next_bits);
+        if (next_size < frontier_size && next_size < n / bfs_beta)
+        {
+          // Switch back to top-down: bits -> frontier queue.
+          is_bottom_up = false;
+          frontier.clear();
+          for (Scalar_index w = 0; w < words; ++w)
+            for (auto bits = frontier_bits[w]; bits; bits &= bits - 1)
+              frontier.push_back(w * word_bits + std::countr_zero(bits));
+        }
+      }
+      else
+      {
+        next.clear();
+        for (auto u: frontier)
+        {
+          for (auto v: out.neighbors(u))
+          {
+            auto& word = visited[v / word_bits];
+            if (word & bit_of(v))
+              continue;
+
+            word |= bit_of(v);
+            if (!discover(v, u))
+              return true;
+
+            next.push_back(v);
+            next_arcs += out.degree(v);
+          }
+        }
+
+        next_size = static_cast<Scalar_size>(next.size());
+        frontier.swap(next);
+      }
+
+      unexplored_arcs -= next_arcs;
+      frontier_arcs    = next_arcs;
+      frontier_size    = next_size;
+    }
+
+    return false;
+  }
+
+  /// @brief Breadth-first graph search in the given mode, see the template version.
+  /// @return true if the search has been finished by the controller, false if the search has been finished by exhaustion
+  auto breadth_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Graph_search_controller_uptr controller,
+    Bfs_mode mode
+  ) -> bool;
+
+
+  /// @brief Level-synchronous parallel breadth-first search.
+  /// The frontier of each level is split between the tasks of the pool, each task keeps the vertices it discovers
+  /// in a buffer of its own, the buffers are concatenated into the next frontier.
+  /// Visited vertices are marked in a lock-free atomic bit vector, so each vertex gets exactly one parent from the previous level,
+  /// which one depends on the thread timing. CSR graph views (see csr_view) are walked through their arrays,
+  /// other graph views must allow concurrent iterate_neighbors calls.
+  /// Throws std::out_of_range if start_index is not a vertex, std::invalid_argument if parents are less than the vertex count.
+  /// @param parents receives the parents: parents[start_index] == start_index, npos for the unreachable vertices (suitable for pred_list_to_tree)
+  void parallel_breadth_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    std::span<Vertex_index> parents,
+    Thread_pool& pool
+  );
+
+  /// @brief Level-synchronous parallel breadth-first search, see the span version.
+  /// @return parents of the vertices, parents[start_index] == start_index, npos for the unreachable vertices
+  [[nodiscard]] auto parallel_breadth_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Thread_pool& pool
+  ) -> std::vector<Vertex_index>;
+
+
   // Utility functions
 
   /// @brief Convert a predecessor list (zero-based array) into a forest represented by a graph view.
@@ -39,9 +39,23 @@ namespace ogxx
       -> Vertex_pair_iterator_uptr = 0;
 
     /// @brief Iterate through neighbors (through the outcoming edges) of the vertex.
+    /// Implementations should construct the iterator in place (see Basic_iterator_handle::emplace) to avoid a heap allocation per call.
     /// @return iterator object iterating through Vertex_index elements.
     [[nodiscard]] virtual auto iterate_neighbors(Vertex_index) const
-      -> Index_iterator_uptr = 0;
+      -> Index_iterator_handle = 0;
+
+    /// @brief Iterate through in-neighbors of the vertex (the tails of the incoming edges).
+    /// These are the neighbors in an undirected graph.
+    /// The default implementation scans all the edges of a directed graph, representations storing in-adjacencies override it.
+    /// @return iterator object iterating through Vertex_index elements.
+    [[nodiscard]] virtual auto iterate_in_neighbors(Vertex_index) const
+      -> Index_iterator_handle;
+
+    /// @brief Get the count of in-neighbors of the vertex (the count of the incoming edges).
+    /// The default implementation counts the items of iterate_in_neighbors.
+    /// @return in-degree of the vertex, 0 for an invalid vertex index
+    [[nodiscard]] virtual auto in_degree(Vertex_index) const
+      -> Scalar_size;
 
     /// @brief Check if two vertices of the graph are connected by an edge.
     /// @param edge a pair of vertex indices to be checked
@@ -6,6 +6,7 @@
 
 #include <ogxx/primitive_definitions.hpp>
 #include <ogxx/iterator.hpp>
+#include <ogxx/iterator_handle.hpp>
 
 
 /// Root namespace of the OGxx library.
@@ -42,6 +43,15 @@ namespace ogxx
     [[nodiscard]] virtual auto iterate() const
       -> Basic_iterator_uptr<See_by<Item>> = 0;
 
+    /// @brief Organize an iteration like iterate() does, but the iterator may be stored in place avoiding a heap allocation.
+    /// The default implementation just wraps the result of iterate().
+    /// @return a handle owning the iterator object
+    [[nodiscard]] virtual auto iterate_handle() const
+      -> Basic_iterator_handle<See_by<Item>>
+    {
+      return iterate();
+    }
+
     /// @brief Check if this iterable range is actually empty.
     /// @return true if it is empty, false otherwise
     [[nodiscard]] virtual auto is_empty() const noexcept
@@ -123,6 +133,14 @@ namespace ogxx
   [[nodiscard]] auto new_index_random_choice_bag(Index_iterator_uptr items) 
     -> Index_bag_uptr;
 
+  /// @brief Create an empty Scalar_index stack: take() returns the item put last.
+  [[nodiscard]] auto new_index_stack()
+    -> Index_bag_uptr;
+
+  /// @brief Create an empty Scalar_index queue: take() returns the item put first.
+  [[nodiscard]] auto new_index_queue()
+    -> Index_bag_uptr;
+
 
   /// @brief Generic container interface with inserts and erases and stores them in linear order as a list.
   /// @tparam Item container item type
@@ -5,6 +5,7 @@
 #define OGXX_ITERATOR_HPP_INCLUDED
 
 #include <ogxx/primitive_definitions.hpp>
+#include <span>
 
 
 /// Root namespace of the OGxx library.
@@ -17,6 +18,9 @@ namespace ogxx
   class Basic_iterator
   {
   public:
+    /// @brief The type of the items of the sequence.
+    using Item_type = Item;
+
     virtual ~Basic_iterator() {}
 
     /// @brief Get the next item of the sequence.
@@ -30,12 +34,45 @@ namespace ogxx
     virtual auto next(Item& out_item) noexcept(std::is_nothrow_assignable_v<Item, Item>)
       -> bool = 0;
 
+    /// @brief Get the next several items of the sequence at once (one virtual call per batch instead of one per item).
+    /// The default implementation just calls next() for each slot, concrete iterators are encouraged to override it.
+    /// Possible enumerating using this iterator may be done by the following loop:
+    /// @code{.cpp}
+    ///     Item batch[iterator_batch_size];
+    ///     for (Scalar_size n; (n = iterator->next_batch(batch)) != 0;)
+    ///       do_something_with(std::span(batch, n));
+    /// @endcode
+    /// @param out_items the span where to put the next items of the sequence
+    /// @return how many items were written to the beginning of out_items, a value less than out_items.size() means the sequence is exhausted
+    virtual auto next_batch(std::span<Item> out_items) noexcept(std::is_nothrow_assignable_v<Item, Item>)
+      -> Scalar_size
+    {
+      Scalar_size written = 0;
+      for (auto& out_item: out_items)
+      {
+        if (!next(out_item))
+          break;
+        ++written;
+      }
+
+      return written;
+    }
+
   protected:
+    // Concrete iterators are to be movable to be stored in place by Basic_iterator_handle.
+    Basic_iterator() noexcept = default;
+    Basic_iterator(Basic_iterator const&) noexcept = default;
+    Basic_iterator(Basic_iterator&&) noexcept      = default;
+
     Basic_iterator& operator=(Basic_iterator const&) noexcept = default;
     Basic_iterator& operator=(Basic_iterator&&) noexcept      = default;
   };
 
 
+  /// @brief Recommended capacity of a buffer passed to Basic_iterator::next_batch.
+  constexpr Scalar_size iterator_batch_size = 64;
+
+
   /// @brief An owning pointer to a basic iterator.
   /// @tparam Item basic iterator item type
   template <typename Item>
@@ -11,6 +11,28 @@
 namespace ogxx
 {
 
+  /// @brief Pull a sequence in batches (via next_batch) and pass each batch to a function until it returns false.
+  /// @tparam Item    type of iterated values
+  /// @tparam Consume function object type accepting std::span<Item> and returning bool (true to continue)
+  /// @param iterator collection access object, is left positioned after the last batch consumed
+  /// @param consume  function object called for each non-empty batch of items provided by the iterator
+  /// @return true if the sequence has been exhausted, false if consume has stopped the iteration
+  template <typename Item, typename Consume>
+  auto for_each_batch(Basic_iterator<Item>& iterator, Consume&& consume)
+    -> bool
+  {
+    Item batch[iterator_batch_size];
+    for (;;)
+    {
+      auto const got = iterator.next_batch(batch);
+      if (got != 0 && !consume(std::span<Item>(batch, got)))
+        return false;
+      if (got < iterator_batch_size)
+        return true;
+    }
+  }
+
+
   /// @brief Call a function for each item in a sequence.
   /// @tparam Item    type of iterated values
   /// @tparam Action  function object type accepting Item
@@ -23,8 +45,12 @@ namespace ogxx
   {
     if (iterator)
     {
-      for (Item item; iterator->next(item);)
-        action(item);
+      for_each_batch(*iterator, [&](std::span<Item> items)
+        {
+          for (auto& item: items)
+            action(item);
+          return true;
+        });
     }
     return action;
   }
@@ -63,8 +89,12 @@ namespace ogxx
     Scalar_size result = 0;
     if (iterator)
     {
-      for (Item _item; iterator->next(_item);)
-        result += _item == item;
+      for_each_batch(*iterator, [&](std::span<Item> items)
+        {
+          for (auto const& _item: items)
+            result += _item == item;
+          return true;
+        });
     }
     return result;
   }
@@ -84,9 +114,13 @@ namespace ogxx
     
     if (iterator)
     {
-      for (Item item; iterator->next(item);)
-        if (pred(item))
-          ++result;
+      for_each_batch(*iterator, [&](std::span<Item> items)
+        {
+          for (auto const& item: items)
+            if (pred(item))
+              ++result;
+          return true;
+        });
     }
 
     return result;
@@ -195,9 +229,13 @@ namespace ogxx
   {
     if (iterator)
     {
-      for (Item item; iterator->next(item);)
-        if (!pred(item))
-          return false;
+      return for_each_batch(*iterator, [&](std::span<Item> items)
+        {
+          for (auto const& item: items)
+            if (!pred(item))
+              return false;
+          return true;
+        });
     }
 
     return true;
@@ -216,9 +254,13 @@ namespace ogxx
   {
     if (iterator)
     {
-      for (Item item; iterator->next(item);)
-        if (pred(item))
+      return !for_each_batch(*iterator, [&](std::span<Item> items)
+        {
+          for (auto const& item: items)
+            if (pred(item))
+              return false;
           return true;
+        });
     }
 
     return false;
@@ -255,20 +297,23 @@ namespace ogxx
     if (!it2)
       throw std::invalid_argument("ogxx::equal: it2 is null");
 
-    Item1 item1;
-    Item2 item2;
+    Item1 items1[iterator_batch_size];
+    Item2 items2[iterator_batch_size];
     
     for (;;)
     {
-      bool const
-        got1 = it1->next(item1),
-        got2 = it2->next(item2);
+      auto const
+        got1 = it1->next_batch(items1),
+        got2 = it2->next_batch(items2);
       if (got1 != got2)
         return false;
-      if (!got1) // got1 == got2
+
+      for (Scalar_size i = 0; i < got1; ++i)
+        if (!compare(items1[i], items2[i]))
+          return false;
+
+      if (got1 < iterator_batch_size) // both are exhausted
         return true;
-      if (!compare(item1, item2))
-        return false;       
     }
   }
 
@@ -295,8 +340,12 @@ namespace ogxx
   {
     if (iterator)
     {
-      for (Item item; iterator->next(item);)
-        accum += item;
+      for_each_batch(*iterator, [&](std::span<Item> items)
+        {
+          for (auto const& item: items)
+            accum += item;
+          return true;
+        });
     }
 
     return accum;
@@ -311,8 +360,12 @@ namespace ogxx
   {
     if (iterator)
     {
-      for (Item item; iterator->next(item);)
-        accum = combine(accum, item);
+      for_each_batch(*iterator, [&](std::span<Item> items)
+        {
+          for (auto const& item: items)
+            accum = combine(accum, item);
+          return true;
+        });
     }
 
     return accum;
@@ -344,17 +397,20 @@ namespace ogxx
     if (!it2)
       throw std::invalid_argument("ogxx::inner_product: it2 is null");
 
-    Item1 item1;
-    Item2 item2;
+    Item1 items1[iterator_batch_size];
+    Item2 items2[iterator_batch_size];
 
     for (;;)
     {
-      bool const got1 = it1->next(item1);
-      bool const got2 = it2->next(item2);
-      if (!(got1 && got2))
-        return accum;
+      auto const got1 = it1->next_batch(items1);
+      auto const got2 = it2->next_batch(items2);
+      auto const got  = min(got1, got2);
       
-      accum = add(accum, multiply(item1, item2));
+      for (Scalar_size i = 0; i < got; ++i)
+        accum = add(accum, multiply(items1[i], items2[i]));
+
+      if (got < iterator_batch_size)
+        return accum;
     }
   }
 
@@ -0,0 +1,265 @@
+/// @file iterator_handle.hpp
+/// @brief Value-type owning iterator handle keeping small iterator objects in place (without heap allocation).
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_ITERATOR_HANDLE_HPP_INCLUDED
+#define OGXX_ITERATOR_HANDLE_HPP_INCLUDED
+
+#include <ogxx/iterator.hpp>
+
+#include <cstddef>
+#include <new>
+
+
+/// Root namespace of the OGxx library.
+namespace ogxx
+{
+
+  /// @brief Default size of the inline storage of a Basic_iterator_handle in bytes.
+  constexpr std::size_t iterator_handle_capacity = 64;
+
+
+  /// @brief Operations on an iterator stored in place by Basic_iterator_handle depending on its concrete type.
+  /// @tparam Item basic iterator item type
+  template <typename Item>
+  struct Iterator_handle_ops
+  {
+    /// @brief sizeof the concrete iterator type.
+    std::size_t size;
+    /// @brief Move-construct the iterator at another place and destroy the source object.
+    auto (*relocate)(Basic_iterator<Item>* from, void* to) noexcept -> Basic_iterator<Item>*;
+    /// @brief Move-construct the iterator on the heap and destroy the source object.
+    auto (*relocate_to_heap)(Basic_iterator<Item>* from) -> Basic_iterator<Item>*;
+  };
+
+
+  /// @brief Iterator_handle_ops implementation for a concrete iterator type.
+  template <typename Item, typename Concrete>
+  constexpr Iterator_handle_ops<Item> iterator_handle_ops_for
+  {
+    sizeof(Concrete),
+    [](Basic_iterator<Item>* from, void* to) noexcept -> Basic_iterator<Item>*
+    {
+      auto& source = static_cast<Concrete&>(*from);
+      auto const result = ::new (to) Concrete(std::move(source));
+      source.~Concrete();
+      return result;
+    },
+    [](Basic_iterator<Item>* from) -> Basic_iterator<Item>*
+    {
+      auto& source = static_cast<Concrete&>(*from);
+      auto const result = new Concrete(std::move(source));
+      source.~Concrete();
+      return result;
+    }
+  };
+
+
+  /// @brief Owns a Basic_iterator object like Basic_iterator_uptr does, but stores it in place if it is small enough.
+  /// Thus creating an iterator for a short sequence (e.g. vertex neighbors) needs not a heap allocation.
+  /// Iterators too big for the inline storage (or not nothrow-movable) are allocated on the heap.
+  /// @tparam Item     basic iterator item type
+  /// @tparam Capacity inline storage size in bytes
+  template <typename Item, std::size_t Capacity = iterator_handle_capacity>
+  class Basic_iterator_handle
+  {
+  public:
+    /// @brief The interface of the owned iterator.
+    using Iterator = Basic_iterator<Item>;
+
+    /// @brief Check if an iterator object of type Concrete would be stored in place.
+    template <typename Concrete>
+    static constexpr bool fits_in_place =
+         sizeof(Concrete)  <= Capacity
+      && alignof(Concrete) <= alignof(std::max_align_t)
+      && std::is_nothrow_move_constructible_v<Concrete>;
+
+    /// @brief Create an empty handle.
+    Basic_iterator_handle() noexcept = default;
+
+    /// @brief Create an empty handle.
+    Basic_iterator_handle(std::nullptr_t) noexcept {}
+
+    /// @brief Take ownership of a heap-allocated iterator object.
+    /// @param iterator the object to own (may be null)
+    Basic_iterator_handle(Basic_iterator_uptr<Item> iterator) noexcept
+      : _iter(iterator.release()) {}
+
+    /// @brief Move the iterator from another handle.
+    Basic_iterator_handle(Basic_iterator_handle&& other) noexcept
+    {
+      take(other);
+    }
+
+    /// @brief Move the iterator from a handle with a different inline storage size.
+    /// May allocate if the iterator does not fit into this handle.
+    template <std::size_t Other_capacity>
+    Basic_iterator_handle(Basic_iterator_handle<Item, Other_capacity>&& other)
+    {
+      take(other);
+    }
+
+    /// @brief Destroy the owned iterator, if any, then move the iterator from another handle.
+    auto operator=(Basic_iterator_handle&& other) noexcept
+      -> Basic_iterator_handle&
+    {
+      if (this != &other)
+      {
+        reset();
+        take(other);
+      }
+
+      return *this;
+    }
+
+    Basic_iterator_handle(Basic_iterator_handle const&) = delete;
+    Basic_iterator_handle& operator=(Basic_iterator_handle const&) = delete;
+
+    ~Basic_iterator_handle()
+    {
+      reset();
+    }
+
+    /// @brief Create an iterator object of type Concrete in place (or on the heap if it does not fit).
+    /// @tparam Concrete  iterator implementation class derived from Basic_iterator<Item>
+    /// @param  args      Concrete constructor arguments
+    /// @return reference to the created object
+    template <typename Concrete, typename... Args>
+    auto emplace(Args&&... args)
+      -> Concrete&
+    {
+      static_assert(std::is_base_of_v<Iterator, Concrete>,
+        "Basic_iterator_handle::emplace: Concrete must be derived from Basic_iterator<Item>");
+
+      reset();
+      if constexpr (fits_in_place<Concrete>)
+      {
+        auto const result = ::new (static_cast<void*>(_storage)) Concrete(std::forward<Args>(args)...);
+        _iter = result;
+        _ops  = &iterator_handle_ops_for<Item, Concrete>;
+        return *result;
+      }
+      else
+      {
+        auto const result = new Concrete(std::forward<Args>(args)...);
+        _iter = result;
+        return *result;
+      }
+    }
+
+    /// @brief Destroy the owned iterator making this handle empty.
+    void reset() noexcept
+    {
+      if (!_iter)
+        return;
+
+      if (_ops)
+        _iter->~Iterator();
+      else
+        delete _iter;
+
+      _iter = nullptr;
+      _ops  = nullptr;
+    }
+
+    /// @brief Get a pointer to the owned iterator (null if the handle is empty).
+    [[nodiscard]] auto get() const noexcept
+      -> Iterator* { return _iter; }
+
+    /// @brief Access the owned iterator.
+    [[nodiscard]] auto operator->() const noexcept
+      -> Iterator* { return _iter; }
+
+    /// @brief Access the owned iterator.
+    [[nodiscard]] auto operator*() const noexcept
+      -> Iterator& { return *_iter; }
+
+    /// @brief Check if the handle owns an iterator.
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+      return _iter != nullptr;
+    }
+
+    /// @brief Check if the owned iterator is stored in place (i.e. it has not been heap-allocated).
+    [[nodiscard]] auto is_in_place() const noexcept
+      -> bool { return _ops != nullptr; }
+
+    /// @brief Pass the owned iterator to an owning pointer (moves it to the heap if it was stored in place).
+    /// It makes handles usable with all the functions accepting Basic_iterator_uptr.
+    [[nodiscard]] operator Basic_iterator_uptr<Item>() &&
+    {
+      if (_ops)
+      {
+        auto const result = _ops->relocate_to_heap(_iter);
+        _iter = nullptr;
+        _ops  = nullptr;
+        return Basic_iterator_uptr<Item>(result);
+      }
+
+      return Basic_iterator_uptr<Item>(std::exchange(_iter, nullptr));
+    }
+
+  private:
+    template <typename, std::size_t>
+    friend class Basic_iterator_handle;
+
+    using Ops = Iterator_handle_ops<Item>;
+
+    alignas(std::max_align_t) std::byte _storage[Capacity];
+    Iterator*  _iter = nullptr;
+    Ops const* _ops  = nullptr; ///< null if the iterator is heap-allocated
+
+    template <std::size_t Other_capacity>
+    void take(Basic_iterator_handle<Item, Other_capacity>& other)
+    {
+      if (!other._ops)
+      {
+        _iter = std::exchange(other._iter, nullptr);
+        return;
+      }
+
+      if (other._ops->size <= Capacity)
+      {
+        _iter = other._ops->relocate(other._iter, _storage);
+        _ops  = other._ops;
+      }
+      else
+      {
+        _iter = other._ops->relocate_to_heap(other._iter);
+      }
+
+      other._iter = nullptr;
+      other._ops  = nullptr;
+    }
+  };
+
+
+  /// @brief Create an iterator object of type Concrete in a new handle.
+  /// @tparam Concrete  iterator implementation class derived from Basic_iterator<Item>
+  /// @tparam Item      iterator item type
+  /// @param  args      Concrete constructor arguments
+  /// @return the handle owning the created object
+  template <typename Concrete, typename Item = typename Concrete::Item_type, typename... Args>
+  [[nodiscard]] auto make_iterator_handle(Args&&... args)
+    -> Basic_iterator_handle<Item>
+  {
+    Basic_iterator_handle<Item> result;
+    result.template emplace<Concrete>(std::forward<Args>(args)...);
+    return result;
+  }
+
+
+  /// @brief Owning handle of a bit iterator object.
+  using Bit_iterator_handle = Basic_iterator_handle<bool>;
+
+  /// @brief Owning handle of an index iterator object.
+  using Index_iterator_handle = Basic_iterator_handle<Scalar_index>;
+
+  /// @brief Owning handle of an integer iterator object.
+  using Int_iterator_handle = Basic_iterator_handle<Int>;
+
+  /// @brief Owning handle of a float iterator object.
+  using Float_iterator_handle = Basic_iterator_handle<Float>;
+
+}
+
+#endif//OGXX_ITERATOR_HANDLE_HPP_INCLUDED
@@ -0,0 +1,73 @@
+/// @file multi_source_bfs.hpp
+/// @brief Multi-source bit-parallel breadth-first search (MS-BFS) for batched hop distance queries.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_MULTI_SOURCE_BFS_HPP_INCLUDED
+#define OGXX_MULTI_SOURCE_BFS_HPP_INCLUDED
+
+#include <ogxx/graph_view.hpp>
+#include <ogxx/st_matrix.hpp>
+#include <ogxx/thread_pool.hpp>
+
+#include <span>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief            Compute hop counts from many sources by multi-source bit-parallel BFS (Then et al.):
+  ///                   the sources are taken in batches of 64 or 256, each vertex keeps one bit per source of the batch,
+  ///                   so one scan of the neighbors of a vertex advances all the searches of the batch that have reached it.
+  ///                   Batches are run in parallel. The arcs are walked through the CSR arrays (see csr_view),
+  ///                   other graph views are converted by new_adjacency_list_csr first.
+  /// Throws std::out_of_range if a source is not a vertex, std::invalid_argument if distances has less rows than sources
+  /// or less columns than vertices.
+  /// @param graph      the arcs to follow
+  /// @param sources    start vertices, repetitions are allowed
+  /// @param distances  row i receives the hop counts from sources[i], int_infinity for the unreachable vertices
+  /// @param pool       threads to run the batches
+  void multi_source_bfs(Graph_view const& graph, std::span<Vertex_index const> sources,
+      Int_matrix& distances, Thread_pool& pool);
+
+  /// @brief            Compute hop counts from many sources, see the version with distances.
+  /// @return           sources.size() x vertex_count matrix, int_infinity for the unreachable vertices
+  [[nodiscard]] auto multi_source_bfs(Graph_view const& graph, std::span<Vertex_index const> sources,
+      Thread_pool& pool)
+    -> Int_matrix_uptr;
+
+
+  /// @brief            Compute all pairs hop counts (unweighted shortest path lengths) by multi-source BFS from all the vertices,
+  ///                   O(V (V + E) / 64) word operations instead of O(V^3) of floyd_warshall_only_matrix on a 1 / infinity matrix.
+  ///                   The searches follow the reversed arcs so that each batch of sources fills a tile of adjacent columns.
+  /// @param graph      the arcs to follow
+  /// @param pool       threads to run the batches
+  /// @return           dense V x V matrix, (i, j) is the hop count of a shortest path from i to j, int_infinity if there is no path
+  [[nodiscard]] auto all_pairs_hop_distances(Graph_view const& graph, Thread_pool& pool)
+    -> Int_matrix_uptr;
+
+
+  /// @brief Aggregated hop counts from one source.
+  struct Hop_summary
+  {
+    Scalar_size reached      = 0; ///< vertices reachable from the source including itself
+    Scalar_size distance_sum = 0; ///< sum of the hop counts to the reachable vertices
+    Int         eccentricity = 0; ///< the greatest hop count to a reachable vertex
+
+    /// @brief Closeness centrality within the reachable part: (reached - 1) / distance_sum, 0 if nothing else is reachable.
+    [[nodiscard]] auto closeness() const noexcept
+      -> Float
+    {
+      return distance_sum == 0? 0.0: Float(reached - 1) / Float(distance_sum);
+    }
+  };
+
+  /// @brief            Aggregate hop counts from many sources by multi-source BFS without storing the distances,
+  ///                   see multi_source_bfs. Throws std::out_of_range if a source is not a vertex.
+  /// @return           summary i describes the search from sources[i]
+  [[nodiscard]] auto multi_source_bfs_summary(Graph_view const& graph, std::span<Vertex_index const> sources,
+      Thread_pool& pool)
+    -> std::vector<Hop_summary>;
+
+}
+
+#endif//OGXX_MULTI_SOURCE_BFS_HPP_INCLUDED
@@ -44,6 +44,13 @@ namespace ogxx
   /// @brief Infinity float value for convenience.
   constexpr Float infinity = std::numeric_limits<Float>::infinity();
 
+  /// @brief Infinity Int value ("no path" length for integer path algorithms).
+  constexpr Int int_infinity = std::numeric_limits<Int>::max();
+
+  /// @brief "No path" length (and "no edge" weight) of a weight type: int_infinity for Int, infinity for Float.
+  template <typename Weight>
+  constexpr Weight no_path_length = std::is_same_v<Weight, Int>? Weight(int_infinity): Weight(infinity);
+
   /// @brief Not-a-number constant.
   constexpr Float not_a_number = std::numeric_limits<Float>::quiet_NaN();
 
@@ -94,6 +94,35 @@ namespace ogxx
   [[nodiscard]] auto new_index_set_vector(Index_iterator_uptr)
     -> Index_set_uptr;
 
+
+  // Bulk set algebra.
+  // Pairs of sets of the library implementations are processed by specialized loops without a virtual call per item:
+  // merging or galloping over sorted vectors, word AND/OR over bit vectors, probing hashtables directly.
+  // Other sets are processed by iterating one set and calling contains() of the other one,
+  // so at least one of the arguments should be iterable (implement Iterable<Scalar_index>), otherwise std::invalid_argument is thrown.
+  // Result sets use the same implementation as the first argument (sorted vector for other implementations).
+
+  /// @brief Count the items belonging to both a and b without building the intersection.
+  [[nodiscard]] auto intersection_count(Index_set const& a, Index_set const& b)
+    -> Scalar_size;
+
+  /// @brief Create a new set containing the items belonging to both a and b.
+  [[nodiscard]] auto set_intersection(Index_set const& a, Index_set const& b)
+    -> Index_set_uptr;
+
+  /// @brief Create a new set containing the items belonging to a or b (a must be iterable).
+  [[nodiscard]] auto set_union(Index_set const& a, Index_set const& b)
+    -> Index_set_uptr;
+
+  /// @brief Create a new set containing the items of a not belonging to b (a must be iterable).
+  [[nodiscard]] auto set_difference(Index_set const& a, Index_set const& b)
+    -> Index_set_uptr;
+
+  /// @brief Insert all the items of source into target (in-place union, source must be iterable).
+  /// @return how many items have been inserted
+  auto insert_all(Index_set& target, Index_set const& source)
+    -> Scalar_size;
+
 }
 
 #endif//OGXX_ST_SET_HPP_INCLUDED
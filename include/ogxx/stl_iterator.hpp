@@ -6,6 +6,7 @@
 
 #include <iterator>
 #include <ogxx/iterator.hpp>
+#include <ogxx/iterator_handle.hpp>
 
 
 /// Root namespace of the OGxx library.
@@ -41,6 +42,7 @@ namespace ogxx
     /// @tparam Range type of the range
     /// @param range  reference to a range
     template <typename Range>
+      requires (!std::is_same_v<std::remove_cvref_t<Range>, Stl_iterator>)
     Stl_iterator(Range&& range)
       : Stl_iterator(std::ranges::begin(range), std::ranges::end(range)) {}
 
@@ -59,6 +61,26 @@ namespace ogxx
       return true;
     }
 
+    /// @brief Get the next items of the sequence without a virtual call per item.
+    /// @param out_items where to put the values of the next items
+    /// @return how many items have been written, less than out_items.size() only if the range is exhausted
+    auto next_batch(std::span<T> out_items) noexcept
+      -> Scalar_size                        override
+    {
+      Scalar_size written = 0;
+      for (auto& out_item: out_items)
+      {
+        if (current == end)
+          break;
+
+        out_item = convert(*current);
+        ++current;
+        ++written;
+      }
+
+      return written;
+    }
+
   private:
     It    current;
     Sent  end;
@@ -88,6 +110,30 @@ namespace ogxx
     return std::make_unique<Iterator>(std::forward<Range>(range));
   }
 
+
+  /// @brief Create an Stl_iterator object for the given begin, end pair in place of a handle.
+  template <typename It, typename Sent>
+  auto make_stl_iterator_handle(It begin, Sent end)
+    -> Basic_iterator_handle<std::iter_value_t<It>>
+  {
+    using Iterator = Stl_iterator<std::iter_value_t<It>, It, Sent>;
+    return make_iterator_handle<Iterator>(begin, end);
+  }
+
+
+  /// @brief Create an Stl_iterator object iterating over the given range in place of a handle.
+  template <typename Range>
+  auto make_stl_iterator_handle(Range&& range)
+    -> Basic_iterator_handle<std::ranges::range_value_t<Range>>
+  {
+    using Iterator = Stl_iterator<
+      std::ranges::range_value_t<Range>, 
+      std::ranges::iterator_t<Range>,
+      std::ranges::sentinel_t<Range>>;
+
+    return make_iterator_handle<Iterator>(std::forward<Range>(range));
+  }
+
 }
 
 #endif//OGXX_STL_ITERATOR_HPP_INCLUDED
@@ -0,0 +1,61 @@
+/// @file strongly_connected_components.hpp
+/// @brief Strongly connected components of directed graphs and their condensation.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_STRONGLY_CONNECTED_COMPONENTS_HPP_INCLUDED
+#define OGXX_STRONGLY_CONNECTED_COMPONENTS_HPP_INCLUDED
+
+#include <ogxx/graph_view.hpp>
+#include <ogxx/thread_pool.hpp>
+
+#include <span>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief Strongly connected components: each vertex gets the index of its component.
+  struct Strong_components
+  {
+    std::vector<Vertex_index> labels; ///< labels[v] is the component of v, 0 <= labels[v] < count
+    Scalar_size               count = 0;
+  };
+
+
+  /// @brief            Find strongly connected components by Pearce's variant of Tarjan's algorithm,
+  ///                   the depth-first search runs on an explicit stack, so deep graphs need no recursion.
+  ///                   Extra memory: the rindex array, the component stack and the search stack, at most V entries each.
+  ///                   The arcs are walked through the CSR arrays (see csr_view),
+  ///                   other graph views are converted by new_adjacency_list_csr first.
+  /// @param graph      the arcs (an undirected graph gives its connected components)
+  /// @return           components numbered in reverse topological order: an arc between different components
+  ///                   goes from a greater label to a lesser one
+  [[nodiscard]] auto strongly_connected_components(Graph_view const& graph)
+    -> Strong_components;
+
+  /// @brief            Find strongly connected components in parallel: vertices without in-arcs or out-arcs are trimmed
+  ///                   repeatedly, the component of a vertex with many arcs is found by forward-backward reachability,
+  ///                   the rest is processed by coloring rounds (the greatest vertex index is propagated along the arcs,
+  ///                   then each vertex keeping its own color collects its component by backward search within the color).
+  ///                   In-arcs are taken from csc_view if the graph is a view of a bidirectional CSR adjacency list,
+  ///                   otherwise the arcs are transposed.
+  /// @param graph      the arcs
+  /// @param pool       threads to process the vertices
+  /// @return           components numbered in no particular order
+  [[nodiscard]] auto strongly_connected_components(Graph_view const& graph, Thread_pool& pool)
+    -> Strong_components;
+
+
+  /// @brief            Emit the condensation of a graph: one vertex per component and an arc between two components
+  ///                   if an arc of the graph goes between their vertices (each such pair is connected once).
+  ///                   For the components of a directed graph the result is acyclic.
+  /// @param graph      the arcs
+  /// @param components the components of graph, e.g. strongly_connected_components(graph)
+  /// @param dag        receives the condensation, its vertex count is enlarged to components.count if needed
+  /// @return           the count of the arcs connected
+  auto condensation(Graph_view const& graph, Strong_components const& components, Graph_view& dag)
+    -> Scalar_size;
+
+}
+
+#endif//OGXX_STRONGLY_CONNECTED_COMPONENTS_HPP_INCLUDED
@@ -0,0 +1,66 @@
+/// @file thread_pool.hpp
+/// @brief Thread_pool running parallel loops of parallel algorithms.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_THREAD_POOL_HPP_INCLUDED
+#define OGXX_THREAD_POOL_HPP_INCLUDED
+
+#include <ogxx/primitive_definitions.hpp>
+
+
+namespace ogxx
+{
+
+  /// @brief A fixed set of worker threads running one parallel loop at a time.
+  /// The thread calling parallel_for works too and returns when the whole loop is done.
+  /// Calling parallel_for from inside a task runs the inner loop in the calling thread.
+  /// Loops requested concurrently by different threads are run one after another.
+  class Thread_pool
+  {
+  public:
+    /// @brief Start the workers.
+    /// @param thread_count how many threads run a loop including the calling one, 0 means hardware concurrency
+    explicit Thread_pool(Scalar_size thread_count = 0);
+
+    /// @brief Stop and join the workers.
+    ~Thread_pool();
+
+    Thread_pool(Thread_pool const&) = delete;
+    Thread_pool& operator=(Thread_pool const&) = delete;
+
+    /// @brief How many threads run a loop including the calling one (at least 1).
+    [[nodiscard]] auto thread_count() const noexcept
+      -> Scalar_size;
+
+    /// @brief Restart the workers to get another thread count (0 means hardware concurrency).
+    /// Must not be called while a loop is being run.
+    void set_thread_count(Scalar_size thread_count);
+
+    /// @brief Call task(i) for each i in [0, count) in parallel, indices are taken one by one by free threads.
+    /// The first exception thrown by a task stops taking new indices and is rethrown here.
+    template <typename Task>
+    void parallel_for(Scalar_size count, Task&& task)
+    {
+      using Task_type = std::remove_reference_t<Task>;
+      run(count, [](void* context, Scalar_index index)
+        {
+          (*static_cast<Task_type*>(context))(index);
+        }, const_cast<void*>(static_cast<void const*>(std::addressof(task))));
+    }
+
+  private:
+    using Task_call = void (*)(void* context, Scalar_index index);
+
+    void run(Scalar_size count, Task_call call, void* context);
+
+    struct State;
+    std::unique_ptr<State> _state;
+  };
+
+
+  /// @brief Get the process-wide pool used by parallel algorithms by default (hardware concurrency threads).
+  [[nodiscard]] auto default_thread_pool()
+    -> Thread_pool&;
+
+}
+
+#endif//OGXX_THREAD_POOL_HPP_INCLUDED
@@ -0,0 +1,69 @@
+/// @file topological_sort.hpp
+/// @brief Topological levels of directed graphs and cycle witnesses.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_TOPOLOGICAL_SORT_HPP_INCLUDED
+#define OGXX_TOPOLOGICAL_SORT_HPP_INCLUDED
+
+#include <ogxx/graph_view.hpp>
+#include <ogxx/thread_pool.hpp>
+
+#include <span>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief Vertices partitioned into topological levels: level 0 has no in-arcs,
+  /// each vertex of level k > 0 has all its in-arcs from levels below k and at least one from level k - 1.
+  /// All the vertices of a level may be processed at once (e.g. build steps run in parallel).
+  struct Topological_levels
+  {
+    std::vector<Vertex_index> order;        ///< the vertices level by level, a topological order of the acyclic part
+    std::vector<Scalar_index> level_starts; ///< level k is order[level_starts[k]] ... order[level_starts[k + 1] - 1]
+    Scalar_size               unordered = 0;///< vertices left out as lying on a cycle or reachable from one, 0 for an acyclic graph
+
+    /// @brief Check if all the vertices have been ordered.
+    [[nodiscard]] auto is_acyclic() const noexcept
+      -> bool
+    {
+      return unordered == 0;
+    }
+
+    /// @brief Get the count of levels.
+    [[nodiscard]] auto level_count() const noexcept
+      -> Scalar_size
+    {
+      return level_starts.empty()? 0: static_cast<Scalar_size>(level_starts.size()) - 1;
+    }
+
+    /// @brief Get the vertices of a level (valid index is required).
+    [[nodiscard]] auto level(Scalar_index index) const noexcept
+      -> std::span<Vertex_index const>
+    {
+      return std::span(order).subspan(level_starts[index], level_starts[index + 1] - level_starts[index]);
+    }
+  };
+
+
+  /// @brief            Partition the vertices into topological levels by Kahn's algorithm:
+  ///                   the in-degrees are counted, then the vertices of each level are processed in parallel
+  ///                   decrementing the in-degrees of their out-neighbors atomically, a vertex whose in-degree drops
+  ///                   to zero joins the next level. The arcs are walked through the CSR arrays (see csr_view),
+  ///                   other graph views are converted by new_adjacency_list_csr first.
+  /// @param graph      the arcs (of a directed graph: an undirected edge is a cycle)
+  /// @param pool       threads to process the levels
+  /// @return           the levels, the vertices of the cycles (see find_cycle) and the vertices reachable from them are left out
+  [[nodiscard]] auto topological_levels(Graph_view const& graph, Thread_pool& pool)
+    -> Topological_levels;
+
+  /// @brief            Find a cycle by an iterative depth-first search stopping at the first arc back to an open vertex.
+  /// @param graph      the arcs
+  /// @return           vertices v0, v1, ..., vk of a cycle: arcs v0 -> v1 -> ... -> vk -> v0 (just v0 for a self-loop),
+  ///                   suitable for is_loop; empty if the graph is acyclic
+  [[nodiscard]] auto find_cycle(Graph_view const& graph)
+    -> std::vector<Vertex_index>;
+
+}
+
+#endif//OGXX_TOPOLOGICAL_SORT_HPP_INCLUDED
@@ -0,0 +1,40 @@
+/// @file triangle_counting.hpp
+/// @brief Triangle counting and clustering coefficients.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_TRIANGLE_COUNTING_HPP_INCLUDED
+#define OGXX_TRIANGLE_COUNTING_HPP_INCLUDED
+
+#include <ogxx/graph_view.hpp>
+#include <ogxx/thread_pool.hpp>
+
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief Triangles of a graph taken as undirected.
+  struct Triangle_counts
+  {
+    Scalar_size              total        = 0;  ///< the count of triangles
+    Float                    transitivity = 0;  ///< global clustering coefficient: 3 total / the count of paths of length 2, 0 if there is no such path
+    std::vector<Scalar_size> per_vertex;        ///< per_vertex[v] is the count of triangles containing v
+    std::vector<Float>       clustering;        ///< local clustering coefficient: per_vertex[v] / (d (d - 1) / 2) for degree d, 0 if d < 2
+  };
+
+
+  /// @brief            Count triangles: the edges are oriented from the lesser (degree, index) end to the greater one,
+  ///                   so each triangle is found once as u -> v -> w with u -> w, by intersecting the sorted
+  ///                   out-neighbors of u and v (merging, or galloping through the longer list if the lengths differ much).
+  ///                   Vertices are processed in parallel by small blocks taken dynamically.
+  ///                   The arcs are walked through the CSR arrays (see csr_view),
+  ///                   other graph views are converted by new_adjacency_list_csr first.
+  /// @param graph      the edges: an arc in either direction makes an undirected edge, self-loops and repeated arcs are ignored
+  /// @param pool       threads to process the vertices
+  /// @return           global and per-vertex counts and clustering coefficients
+  [[nodiscard]] auto count_triangles(Graph_view const& graph, Thread_pool& pool)
+    -> Triangle_counts;
+
+}
+
+#endif//OGXX_TRIANGLE_COUNTING_HPP_INCLUDED
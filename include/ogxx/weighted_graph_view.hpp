@@ -0,0 +1,178 @@
+/// @file weighted_graph_view.hpp
+/// @brief Graph view extension carrying edge weights in a column aligned with the CSR neighbor array.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_WEIGHTED_GRAPH_VIEW_HPP_INCLUDED
+#define OGXX_WEIGHTED_GRAPH_VIEW_HPP_INCLUDED
+
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/edge_list.hpp>
+#include <ogxx/st_matrix.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <span>
+
+
+namespace ogxx
+{
+
+  /// @brief Neighbors of a vertex together with the weights of the arcs leading to them.
+  template <typename Weight>
+  struct Weighted_neighbors
+  {
+    /// @brief Sorted neighbor indices.
+    std::span<Vertex_index const> vertices;
+    /// @brief weights[i] is the weight of the arc to vertices[i].
+    std::span<Weight const>       weights;
+
+    /// @brief Get the count of neighbors.
+    [[nodiscard]] auto size() const noexcept
+      -> Scalar_size
+    {
+      return static_cast<Scalar_size>(vertices.size());
+    }
+  };
+
+
+  /// @brief CSR arrays of a graph with the weight column: weights[a] is the weight of the arc to targets[a].
+  template <typename Weight>
+  struct Weighted_csr_view
+    : Csr_view
+  {
+    /// @brief Weights of the arcs, weights.size() == targets.size().
+    std::span<Weight const> weights;
+
+    /// @brief Get the neighbors of a vertex and the weights of the arcs (valid index is required).
+    [[nodiscard]] auto weighted_neighbors(Vertex_index vertex) const noexcept
+      -> Weighted_neighbors<Weight>
+    {
+      auto const first = offsets[vertex];
+      auto const count = degree(vertex);
+      return { targets.subspan(first, count), weights.subspan(first, count) };
+    }
+  };
+
+
+  /// @brief Graph view of a read-only graph with a weight per arc.
+  /// Arcs are stored in the CSR format (see Csr_view), their weights in a separate column
+  /// so that walking neighbors and weights reads two contiguous arrays.
+  /// An undirected edge is stored as two arcs, both have its weight.
+  /// @tparam Weight Int or Float
+  template <typename Weight>
+  class Weighted_graph_view
+    : public Graph_view
+  {
+  public:
+    using Weight_type = Weight;
+
+    /// @brief Get the CSR arrays and the weight column of the graph.
+    [[nodiscard]] virtual auto weighted_csr() const noexcept
+      -> Weighted_csr_view<Weight> = 0;
+
+    /// @brief Get all the neighbors of a vertex with the arc weights at once.
+    /// @return aligned spans of neighbors and weights, empty for an invalid vertex index
+    [[nodiscard]] auto weighted_neighbors(Vertex_index vertex) const noexcept
+      -> Weighted_neighbors<Weight>
+    {
+      auto const csr = weighted_csr();
+      if (vertex < 0 || csr.vertex_count() <= vertex)
+        return {};
+      return csr.weighted_neighbors(vertex);
+    }
+
+    /// @brief Get the weight of an arc.
+    /// @param edge (from, to) pair of vertex indices
+    /// @return the weight or no_path_length<Weight> if there is no such arc
+    [[nodiscard]] auto weight(Vertex_pair edge) const noexcept
+      -> Weight
+    {
+      auto const [vertices, weights] = weighted_neighbors(edge.first);
+      auto const found = std::lower_bound(vertices.begin(), vertices.end(), edge.second);
+      if (found == vertices.end() || *found != edge.second)
+        return no_path_length<Weight>;
+      return weights[found - vertices.begin()];
+    }
+
+    /// @brief Get the weight of the arc from -> to, see weight(Vertex_pair).
+    [[nodiscard]] auto weight(Vertex_index from, Vertex_index to) const noexcept
+      -> Weight { return weight(Vertex_pair{ from, to }); }
+  };
+
+
+  /// @brief Weighted graph view with integer weights.
+  using Int_weighted_graph_view = Weighted_graph_view<Int>;
+
+  /// @brief Weighted graph view with floating point weights.
+  using Float_weighted_graph_view = Weighted_graph_view<Float>;
+
+  /// @brief Owning pointer to a weighted graph view with integer weights.
+  using Int_weighted_graph_view_uptr = std::unique_ptr<Int_weighted_graph_view>;
+
+  /// @brief Owning pointer to a weighted graph view with floating point weights.
+  using Float_weighted_graph_view_uptr = std::unique_ptr<Float_weighted_graph_view>;
+
+
+  // All the factories copy the data: the result does not refer to the source.
+  // Repeated arcs are merged keeping the least weight, arcs weighing no_path_length are dropped.
+
+  /// @brief Create a weighted graph view of an edge list.
+  /// Throws std::invalid_argument if weights.size() differs from the edge count or an index is negative.
+  /// @param edges        the edges
+  /// @param weights      weights[i] is the weight of the i-th edge listed by edges.iterate()
+  /// @param is_directed  make arcs a -> b only (true) or both a -> b and b -> a (false) out of (a, b)
+  /// @param vertex_count minimal vertex count of the result, it is extended to cover all the indices in edges
+  [[nodiscard]] auto new_weighted_graph_view(Edge_list const& edges, std::span<Int const> weights,
+      bool is_directed, Scalar_size vertex_count = 0)
+    -> Int_weighted_graph_view_uptr;
+
+  /// @brief Create a weighted graph view of an edge list, see the Int version.
+  [[nodiscard]] auto new_weighted_graph_view(Edge_list const& edges, std::span<Float const> weights,
+      bool is_directed, Scalar_size vertex_count = 0)
+    -> Float_weighted_graph_view_uptr;
+
+  /// @brief Attach weights to the arcs of a graph, e.g. of an adjacency list viewed by directed::graph_view or undirected::graph_view.
+  /// Throws std::invalid_argument if weights do not cover the vertices.
+  /// @param graph        the arcs (both directions of the edges of an undirected graph)
+  /// @param weights      weights(u, v) is the weight of the arc u -> v, only the entries of the arcs are read
+  [[nodiscard]] auto new_weighted_graph_view(Graph_view const& graph, Int_matrix const& weights)
+    -> Int_weighted_graph_view_uptr;
+
+  /// @brief Attach weights to the arcs of a graph, see the Int version.
+  [[nodiscard]] auto new_weighted_graph_view(Graph_view const& graph, Float_matrix const& weights)
+    -> Float_weighted_graph_view_uptr;
+
+  /// @brief Attach weights computed by a function to the arcs of a graph.
+  /// @param graph        the arcs (both directions of the edges of an undirected graph)
+  /// @param weight       weight(u, v) is the weight of the arc u -> v, it is called once per arc
+  [[nodiscard]] auto new_weighted_graph_view(Graph_view const& graph, std::function<Int(Vertex_index, Vertex_index)> const& weight)
+    -> Int_weighted_graph_view_uptr;
+
+  /// @brief Attach weights computed by a function to the arcs of a graph, see the Int version.
+  [[nodiscard]] auto new_weighted_graph_view(Graph_view const& graph, std::function<Float(Vertex_index, Vertex_index)> const& weight)
+    -> Float_weighted_graph_view_uptr;
+
+  /// @brief Attach weights computed by a callable object to the arcs of a graph,
+  /// the weight type is Float if it returns a floating point number and Int otherwise.
+  template <typename Weight_function>
+    requires std::is_invocable_v<Weight_function const&, Vertex_index, Vertex_index>
+  [[nodiscard]] auto new_weighted_graph_view(Graph_view const& graph, Weight_function const& weight)
+  {
+    using Result = std::invoke_result_t<Weight_function const&, Vertex_index, Vertex_index>;
+    using Weight = std::conditional_t<std::is_floating_point_v<Result>, Float, Int>;
+    return new_weighted_graph_view(graph, std::function<Weight(Vertex_index, Vertex_index)>(weight));
+  }
+
+  /// @brief Create a weighted graph view of a dense weighted adjacency matrix.
+  /// Each off-diagonal entry other than no_path_length is an arc, diagonal entries (zero distances) are ignored.
+  /// @param weights      square matrix, weights(u, v) is the weight of the arc u -> v
+  /// @param is_directed  read all the entries (true) or the entries above the diagonal as undirected edges (false)
+  [[nodiscard]] auto new_weighted_graph_view(Int_matrix const& weights, bool is_directed = true)
+    -> Int_weighted_graph_view_uptr;
+
+  /// @brief Create a weighted graph view of a dense weighted adjacency matrix, see the Int version.
+  [[nodiscard]] auto new_weighted_graph_view(Float_matrix const& weights, bool is_directed = true)
+    -> Float_weighted_graph_view_uptr;
+
+}
+
+#endif//OGXX_WEIGHTED_GRAPH_VIEW_HPP_INCLUDED
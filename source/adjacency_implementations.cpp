@@ -39,6 +39,9 @@ namespace ogxx
 
       auto iterate() const
         -> Index_iterator_uptr override { return Base::iterate(); }
+
+      auto iterate_handle() const
+        -> Index_iterator_handle override { return Base::iterate_handle(); }
     };
 
     template <typename Base>
@@ -67,6 +70,9 @@ namespace ogxx
       auto iterate() const
         -> Index_iterator_uptr override { return Base::iterate(); }
 
+      auto iterate_handle() const
+        -> Index_iterator_handle override { return Base::iterate_handle(); }
+
       auto get(Scalar_index index) const
         -> See_by<Scalar_index>    override { return Base::get(index); }
 
@@ -122,7 +128,17 @@ namespace ogxx
 
   // Adjacency lists
 
-  // TODO: Adjacency_list_vector
-  // TODO: Adjacency_list_hashtable
+  auto Adjacency_list::get_or_create_adjacency(Vertex_index vertex)
+    -> Adjacency&
+  {
+    if (vertex < get_vertex_count())
+      if (auto const adj_ptr = get(vertex).adjacency)
+        return *adj_ptr;
+
+    auto adj = new_adjacency_sortedvector();
+    auto const adj_ptr = adj.get();
+    set(vertex, { vertex, adj.release() });
+    return *adj_ptr;
+  }
 
 }
@@ -0,0 +1,356 @@
+/// @file source/adjacency_list_csr.cpp
+/// @brief Compressed sparse row (CSR) adjacency list implementation and construction.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include "adjacency_list_csr.hpp"
+#include <ogxx/stl_iterator.hpp>
+#include <ogxx/iterator_algorithms.hpp>
+#include <ogxx/edge_list.hpp>
+
+#include <algorithm>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+
+
+namespace ogxx
+{
+
+  // Csr_adjacency
+
+  auto Csr_adjacency::contains(Scalar_index item) const noexcept
+    -> bool
+  {
+    return std::binary_search(_begin, _end, item);
+  }
+
+  auto Csr_adjacency::insert(Scalar_index)
+    -> bool
+  {
+    throw std::logic_error("Csr_adjacency::insert: CSR adjacency is read-only.");
+  }
+
+  auto Csr_adjacency::erase(Scalar_index)
+    -> bool
+  {
+    throw std::logic_error("Csr_adjacency::erase: CSR adjacency is read-only.");
+  }
+
+  auto Csr_adjacency::iterate() const
+    -> Index_iterator_uptr
+  {
+    return new_stl_iterator(_begin, _end);
+  }
+
+  auto Csr_adjacency::iterate_handle() const
+    -> Index_iterator_handle
+  {
+    return make_stl_iterator_handle(_begin, _end);
+  }
+
+
+  // Adjacency_list_csr
+
+  Adjacency_list_csr::Adjacency_list_csr(
+      std::vector<Scalar_index> offsets,
+      std::vector<Vertex_index> targets,
+      std::vector<Scalar_index> in_offsets,
+      std::vector<Vertex_index> in_sources)
+    : _offsets(std::move(offsets))
+    , _targets(std::move(targets))
+    , _in_offsets(std::move(in_offsets))
+    , _in_sources(std::move(in_sources))
+  {
+    if (_offsets.empty())
+      _offsets.push_back(0);
+
+    if (_offsets.front() != 0 || _offsets.back() != static_cast<Scalar_index>(_targets.size()))
+      throw std::invalid_argument("Adjacency_list_csr: offsets do not match targets.");
+
+    if (!_in_offsets.empty()
+      && (_in_offsets.size() != _offsets.size()
+        || _in_offsets.front() != 0
+        || _in_offsets.back() != static_cast<Scalar_index>(_in_sources.size())
+        || _in_sources.size() != _targets.size()))
+      throw std::invalid_argument("Adjacency_list_csr: in-offsets do not match in-sources.");
+
+    auto const vertex_count = get_vertex_count();
+    for (Vertex_index v = 0; v < vertex_count; ++v)
+    {
+      if (std::binary_search(
+            _targets.begin() + _offsets[v],
+            _targets.begin() + _offsets[v + 1],
+            v))
+        ++_loop_count;
+    }
+  }
+
+  void Adjacency_list_csr::clear()
+  {
+    throw std::logic_error("Adjacency_list_csr::clear: CSR adjacency list is read-only.");
+  }
+
+  void Adjacency_list_csr::set_vertex_count(Scalar_size)
+  {
+    throw std::logic_error("Adjacency_list_csr::set_vertex_count: CSR adjacency list is read-only.");
+  }
+
+  auto Adjacency_list_csr::get(Scalar_index index) const
+    -> See_by<Adjacency_list_entry>
+  {
+    if (index < 0 || get_vertex_count() <= index)
+      throw std::out_of_range("Adjacency_list_csr::get: index out of range.");
+
+    return { index, &adjacencies()[index] };
+  }
+
+  auto Adjacency_list_csr::set(Scalar_index, Pass_by<Adjacency_list_entry>)
+    -> Pass_by<Adjacency_list_entry>
+  {
+    throw std::logic_error("Adjacency_list_csr::set: CSR adjacency list is read-only.");
+  }
+
+
+  namespace
+  {
+
+    class Csr_adjacency_list_iterator
+      : public Basic_iterator<Adjacency_list_entry>
+    {
+    public:
+      explicit Csr_adjacency_list_iterator(std::vector<Csr_adjacency>& adjacencies) noexcept
+        : _adjacencies(adjacencies) {}
+
+      auto next(Adjacency_list_entry& out_item) noexcept
+        -> bool                                 override
+      {
+        if (_cur == static_cast<Scalar_index>(_adjacencies.size()))
+          return false;
+
+        out_item = { _cur, &_adjacencies[_cur] };
+        ++_cur;
+        return true;
+      }
+
+    private:
+      std::vector<Csr_adjacency>& _adjacencies;
+      Scalar_index                _cur = 0;
+    };
+
+  }
+
+
+  auto Adjacency_list_csr::iterate() const
+    -> Basic_iterator_uptr<Adjacency_list_entry>
+  {
+    return std::make_unique<Csr_adjacency_list_iterator>(adjacencies());
+  }
+
+  auto Adjacency_list_csr::adjacencies() const
+    -> std::vector<Csr_adjacency>&
+  {
+    std::call_once(_adjacencies_made, [this]
+      {
+        auto const vertex_count = get_vertex_count();
+        auto const targets      = _targets.data();
+
+        _adjacencies = std::vector<Csr_adjacency>(vertex_count);
+        for (Vertex_index v = 0; v < vertex_count; ++v)
+          _adjacencies[v].assign(targets + _offsets[v], targets + _offsets[v + 1]);
+      });
+
+    return _adjacencies;
+  }
+
+
+  // Construction
+
+  namespace
+  {
+
+    /// Which arrays to build out of arrows a -> b.
+    enum class Arrows
+    {
+      forward,  ///< a -> b (CSR of out-neighbors)
+      backward, ///< b -> a (CSC, i.e. CSR of in-neighbors)
+      both      ///< a -> b and b -> a (undirected graph)
+    };
+
+    struct Csr_arrays
+    {
+      std::vector<Scalar_index> offsets;
+      std::vector<Vertex_index> targets;
+    };
+
+    /// Two-pass counting construction: count degrees, turn them into offsets, place targets.
+    /// for_each_arrow(consume) calls consume(std::span<Vertex_pair const>) for all the arrows, it is called twice.
+    template <typename For_each_arrow>
+    auto build_csr_arrays(Scalar_size vertex_count, Arrows arrows_kind, For_each_arrow&& for_each_arrow)
+      -> Csr_arrays
+    {
+      auto const both     = arrows_kind == Arrows::both;
+      auto const backward = arrows_kind == Arrows::backward;
+
+      std::vector<Scalar_index> offsets(vertex_count + 1);
+      for_each_arrow([&](std::span<Vertex_pair const> arrows)
+        {
+          for (auto [from, to]: arrows)
+          {
+            if (from < 0 || to < 0 || vertex_count <= max(from, to))
+              throw std::out_of_range("new_adjacency_list_csr: vertex index out of range.");
+
+            if (backward)
+              std::swap(from, to);
+
+            ++offsets[from + 1];
+            if (both && from != to)
+              ++offsets[to + 1];
+          }
+        });
+
+      std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+      std::vector<Vertex_index> targets(offsets.back());
+      std::vector<Scalar_index> place(offsets.begin(), offsets.end() - 1);
+      for_each_arrow([&](std::span<Vertex_pair const> arrows)
+        {
+          for (auto [from, to]: arrows)
+          {
+            if (backward)
+              std::swap(from, to);
+
+            targets[place[from]++] = to;
+            if (both && from != to)
+              targets[place[to]++] = from;
+          }
+        });
+
+      // Sort each adjacency and drop duplicates moving the rest down.
+      Scalar_index written = 0;
+      for (Vertex_index v = 0; v < vertex_count; ++v)
+      {
+        auto const first = targets.begin() + offsets[v];
+        auto const last  = targets.begin() + offsets[v + 1];
+        std::sort(first, last);
+        auto const unique_end = std::unique(first, last);
+
+        offsets[v] = written;
+        written = std::move(first, unique_end, targets.begin() + written) - targets.begin();
+      }
+
+      offsets.back() = written;
+      targets.resize(written);
+      targets.shrink_to_fit();
+
+      return { std::move(offsets), std::move(targets) };
+    }
+
+
+    /// Read all the arrows at once, an iterator can be passed only once.
+    auto buffer_arrows(Basic_iterator<Vertex_pair>* arrows, Scalar_size expected_count = 0)
+      -> std::vector<Vertex_pair>
+    {
+      std::vector<Vertex_pair> buffer;
+      buffer.reserve(expected_count);
+      if (arrows)
+      {
+        for_each_batch(*arrows, [&](std::span<Vertex_pair> batch)
+          {
+            buffer.insert(buffer.end(), batch.begin(), batch.end());
+            return true;
+          });
+      }
+
+      return buffer;
+    }
+
+
+    /// Build CSR and CSC arrays concurrently out of the same arrows.
+    auto build_bidirectional_csr(Scalar_size vertex_count, std::span<Vertex_pair const> arrows)
+      -> Adjacency_list_uptr
+    {
+      auto const for_each_arrow = [arrows](auto&& consume) { consume(arrows); };
+
+      auto in_arrays = std::async(std::launch::async, [&]
+        {
+          return build_csr_arrays(vertex_count, Arrows::backward, for_each_arrow);
+        });
+
+      auto out = build_csr_arrays(vertex_count, Arrows::forward, for_each_arrow);
+      auto in  = in_arrays.get();
+
+      return std::make_unique<Adjacency_list_csr>(
+        std::move(out.offsets), std::move(out.targets),
+        std::move(in.offsets),  std::move(in.targets));
+    }
+
+  }
+
+
+  auto new_adjacency_list_csr(Graph_view const& gv)
+    -> Adjacency_list_uptr
+  {
+    auto const arrows_kind = gv.is_directed()? Arrows::forward: Arrows::both;
+    auto arrays = build_csr_arrays(gv.vertex_count(), arrows_kind, [&gv](auto&& consume)
+      {
+        if (auto const edges = gv.iterate_edges())
+          for_each_batch(*edges, [&](std::span<Vertex_pair> arrows)
+            {
+              consume(arrows);
+              return true;
+            });
+      });
+
+    return std::make_unique<Adjacency_list_csr>(std::move(arrays.offsets), std::move(arrays.targets));
+  }
+
+  auto new_adjacency_list_csr(Vertex_pair_iterator_uptr arrows, Scalar_size vertex_count)
+    -> Adjacency_list_uptr
+  {
+    auto const buffer = buffer_arrows(arrows.get());
+    for (auto [from, to]: buffer)
+      vertex_count = max(vertex_count, max(from, to) + 1);
+
+    auto arrays = build_csr_arrays(vertex_count, Arrows::forward, [&buffer](auto&& consume)
+      {
+        consume(std::span<Vertex_pair const>(buffer));
+      });
+
+    return std::make_unique<Adjacency_list_csr>(std::move(arrays.offsets), std::move(arrays.targets));
+  }
+
+
+  auto new_adjacency_list_bidirectional_csr(Graph_view const& gv)
+    -> Adjacency_list_uptr
+  {
+    if (!gv.is_directed())
+      return new_adjacency_list_csr(gv);
+
+    auto const buffer = buffer_arrows(gv.iterate_edges().get(), gv.edge_count());
+    return build_bidirectional_csr(gv.vertex_count(), buffer);
+  }
+
+  auto new_adjacency_list_bidirectional_csr(Edge_list const& el)
+    -> Adjacency_list_uptr
+  {
+    auto const buffer = buffer_arrows(el.iterate().get(), el.size());
+    return build_bidirectional_csr(el.max_vertex_index() + 1, buffer);
+  }
+
+
+  auto csr_view(Adjacency_list const& al) noexcept
+    -> Csr_view
+  {
+    if (auto const csr = dynamic_cast<Adjacency_list_csr const*>(&al))
+      return csr->csr();
+    return {};
+  }
+
+  auto csc_view(Adjacency_list const& al) noexcept
+    -> Csr_view
+  {
+    if (auto const csr = dynamic_cast<Adjacency_list_csr const*>(&al))
+      return csr->csc();
+    return {};
+  }
+
+}
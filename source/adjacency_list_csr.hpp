@@ -0,0 +1,146 @@
+/// @file source/adjacency_list_csr.hpp
+/// @brief Read-only Adjacency_list implementation in the compressed sparse row (CSR) format.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_ADJACENCY_LIST_CSR_HPP_INCLUDED
+#define OGXX_ADJACENCY_LIST_CSR_HPP_INCLUDED
+
+#include <ogxx/adjacency_list.hpp>
+
+#include <mutex>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief Read-only adjacency of a vertex referring to its range of the CSR targets array.
+  class Csr_adjacency final
+    : public Adjacency
+  {
+  public:
+    Csr_adjacency() noexcept = default;
+
+    /// @brief Refer to a range of the targets array.
+    void assign(Vertex_index const* begin, Vertex_index const* end) noexcept
+    {
+      _begin = begin;
+      _end   = end;
+    }
+
+    /// @brief Get the sorted items.
+    [[nodiscard]] auto items() const noexcept
+      -> std::span<Vertex_index const> { return { _begin, _end }; }
+
+    [[nodiscard]] auto contains(Scalar_index item) const noexcept
+      -> bool override;
+
+    auto insert(Scalar_index item)
+      -> bool override;
+
+    auto erase(Scalar_index item)
+      -> bool override;
+
+    [[nodiscard]] auto is_empty() const noexcept
+      -> bool override { return _begin == _end; }
+
+    [[nodiscard]] auto size() const noexcept
+      -> Scalar_size override { return _end - _begin; }
+
+    [[nodiscard]] auto iterate() const
+      -> Index_iterator_uptr override;
+
+    [[nodiscard]] auto iterate_handle() const
+      -> Index_iterator_handle override;
+
+  private:
+    Vertex_index const* _begin = nullptr;
+    Vertex_index const* _end   = nullptr;
+  };
+
+
+  /// @brief Adjacency list keeping all the adjacencies in one array of targets
+  /// and the offsets of the adjacency of each vertex (plus the end offset) in another array.
+  /// Adjacencies are sorted and contain no duplicates.
+  class Adjacency_list_csr final
+    : public Adjacency_list
+  {
+  public:
+    /// @brief Take the arrays prepared by a builder.
+    /// @param offsets    vertex count + 1 nondecreasing offsets starting with 0 and ending with targets.size()
+    /// @param targets    adjacencies of all vertices one after another, each one sorted without duplicates
+    /// @param in_offsets the same as offsets but for in-adjacencies (CSC), empty if they are not stored
+    /// @param in_sources in-adjacencies of all vertices one after another, each one sorted without duplicates
+    Adjacency_list_csr(
+        std::vector<Scalar_index> offsets,
+        std::vector<Vertex_index> targets,
+        std::vector<Scalar_index> in_offsets = {},
+        std::vector<Vertex_index> in_sources = {});
+
+    // Adjacency_list
+
+    void clear() override;
+
+    [[nodiscard]] auto degrees_sum() const noexcept
+      -> Scalar_size override { return static_cast<Scalar_size>(_targets.size()); }
+
+    [[nodiscard]] auto get_vertex_count() const noexcept
+      -> Scalar_size override { return static_cast<Scalar_size>(_offsets.size()) - 1; }
+
+    void set_vertex_count(Scalar_size new_vertex_count) override;
+
+    [[nodiscard]] auto get(Scalar_index index) const
+      -> See_by<Adjacency_list_entry> override;
+
+    auto set(Scalar_index index, Pass_by<Adjacency_list_entry> value)
+      -> Pass_by<Adjacency_list_entry> override;
+
+    [[nodiscard]] auto size() const noexcept
+      -> Scalar_size override { return get_vertex_count(); }
+
+    [[nodiscard]] auto is_empty() const noexcept
+      -> bool override { return size() == 0; }
+
+    [[nodiscard]] auto iterate() const
+      -> Basic_iterator_uptr<Adjacency_list_entry> override;
+
+    // CSR specific
+
+    /// @brief Get the arrays.
+    [[nodiscard]] auto csr() const noexcept
+      -> Csr_view { return { _offsets, _targets }; }
+
+    /// @brief Get the in-adjacency arrays (empty view if they are not stored).
+    [[nodiscard]] auto csc() const noexcept
+      -> Csr_view { return { _in_offsets, _in_sources }; }
+
+    /// @brief Get the count of loops (v -> v arrows).
+    [[nodiscard]] auto loop_count() const noexcept
+      -> Scalar_size { return _loop_count; }
+
+  private:
+    std::vector<Scalar_index>   _offsets;
+    std::vector<Vertex_index>   _targets;
+    std::vector<Scalar_index>   _in_offsets;
+    std::vector<Vertex_index>   _in_sources;
+    Scalar_size                 _loop_count = 0;
+
+    // Adjacency objects are needed only by the generic interface (get, iterate),
+    // so they are created on the first demand: CSR graph views do not use them.
+    mutable std::once_flag              _adjacencies_made;
+    mutable std::vector<Csr_adjacency>  _adjacencies;
+
+    auto adjacencies() const
+      -> std::vector<Csr_adjacency>&;
+  };
+
+
+  /// @brief Create a read-only graph view of a CSR adjacency list iterating neighbors by a pointer walk.
+  /// @param al          viewed adjacency list, must live while the result graph view is being used
+  /// @param is_directed false if al stores each edge of an undirected graph in both directions
+  /// @return a graph view object, its modifiers throw std::logic_error
+  [[nodiscard]] auto new_graph_view_csr(Adjacency_list_csr const& al, bool is_directed)
+    -> Graph_view_uptr;
+
+}
+
+#endif//OGXX_ADJACENCY_LIST_CSR_HPP_INCLUDED
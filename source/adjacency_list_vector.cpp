@@ -4,6 +4,8 @@
 #include <ogxx/adjacency_list.hpp>
 #include <ogxx/stl_iterator.hpp>
 #include <vector>
+#include <memory_resource>
+#include <algorithm>
 #include <stdexcept>
 
 namespace ogxx
@@ -11,15 +13,28 @@ namespace ogxx
 
   namespace
   {
+    /// Adjacencies are separate heap objects.
     using Adjacency_list_vector_storage
       = std::vector<std::unique_ptr<Adjacency>>;
 
+    /// Adjacencies are allocated from the arena owned by the list.
+    using Adjacency_list_arena_storage
+      = std::vector<Adjacency*>;
+
+    inline auto adjacency_ptr(std::unique_ptr<Adjacency> const& adj) noexcept
+      -> Adjacency* { return adj.get(); }
+
+    inline auto adjacency_ptr(Adjacency* adj) noexcept
+      -> Adjacency* { return adj; }
+
+
+    template <typename Storage>
     class Adjacency_list_vector_iterator
       : public Basic_iterator<See_by<Adjacency_list_entry>>
     {
     public:
       Adjacency_list_vector_iterator(
-        Adjacency_list_vector_storage const& vector)
+        Storage const& vector)
         : _begin(vector.begin()), _end(vector.end()) {}
 
       auto next(See_by<Adjacency_list_entry>& value) noexcept
@@ -29,20 +44,78 @@ namespace ogxx
           return false;
 
         value.vertex    = _cur++;
-        value.adjacency = _begin->get();
+        value.adjacency = adjacency_ptr(*_begin);
         ++_begin;
         return true;
       }
 
     private:
-      Adjacency_list_vector_storage::const_iterator 
+      typename Storage::const_iterator
         _begin,
         _end;
 
       Vertex_index _cur = 0;
     };
+
+
+    /// @brief Sorted vector adjacency keeping its items in an arena (the arena memory is never given back item by item).
+    class Adjacency_arena final
+      : public Adjacency
+    {
+    public:
+      explicit Adjacency_arena(std::pmr::memory_resource* arena)
+        : _items(arena) {}
+
+      auto contains(Scalar_index item) const noexcept
+        -> bool override
+      {
+        return std::binary_search(_items.begin(), _items.end(), item);
+      }
+
+      auto insert(Scalar_index item)
+        -> bool override
+      {
+        auto const it = std::lower_bound(_items.begin(), _items.end(), item);
+        if (it != _items.end() && *it == item)
+          return false;
+
+        _items.insert(it, item);
+        return true;
+      }
+
+      auto erase(Scalar_index item)
+        -> bool override
+      {
+        auto const it = std::lower_bound(_items.begin(), _items.end(), item);
+        if (it == _items.end() || *it != item)
+          return false;
+
+        _items.erase(it);
+        return true;
+      }
+
+      auto is_empty() const noexcept
+        -> bool       override { return _items.empty(); }
+
+      auto size() const noexcept
+        -> Scalar_size  override { return static_cast<Scalar_size>(_items.size()); }
+
+      auto iterate() const
+        -> Index_iterator_uptr override { return new_stl_iterator(_items); }
+
+      auto iterate_handle() const
+        -> Index_iterator_handle override { return make_stl_iterator_handle(_items); }
+
+    private:
+      std::pmr::vector<Scalar_index> _items;
+    };
   }
 
+
+  /// @brief Adjacency list mapping vertex indices to adjacencies by a vector.
+  /// @tparam use_arena if true then all the adjacencies and their items are allocated from one monotonic arena:
+  /// no allocator metadata per vertex, and destruction (or clear) releases the arena as a whole without visiting adjacencies
+  template <bool use_arena>
   class Adjacency_list_vector
     : public Adjacency_list
   {
@@ -55,8 +128,9 @@ namespace ogxx
       -> Scalar_size   override
     {
         Scalar_size deg_sum = 0;
-        for (int i = 0; i < _adj.size(); i++) {
-            deg_sum += _adj[i]->size();
+        for (auto& ap: _adj) {
+            if (ap)
+              deg_sum += ap->size();
         }
         return deg_sum;
     }
@@ -77,6 +151,9 @@ namespace ogxx
       {
           std::vector <Vertex_index> v;
           for (auto& ap: _adj) {
+              if (!ap)
+                continue;
+
               v.clear();
               auto it = ap->iterate();
               for (Vertex_index value; it->next(value);)
@@ -85,7 +162,7 @@ namespace ogxx
               for (auto u: v) {
                   ap->erase(u);
               }
-          
+
           }
       }
     }
@@ -93,6 +170,30 @@ namespace ogxx
     void clear() override
     {
       _adj.clear();
+      if constexpr (use_arena)
+        _arena.release();
+    }
+
+    auto get_or_create_adjacency(Vertex_index vertex)
+      -> Adjacency&                    override
+    {
+      if constexpr (use_arena)
+      {
+        if (vertex < 0)
+          throw std::out_of_range("Adjacency_list_vector::get_or_create_adjacency: negative vertex index");
+
+        if (auto const needed_sz = static_cast<size_t>(vertex + 1); _adj.size() < needed_sz)
+          _adj.resize(needed_sz);
+
+        auto& ap = _adj[vertex];
+        if (!ap)
+          ap = new_arena_adjacency();
+        return *ap;
+      }
+      else
+      {
+        return Adjacency_list::get_or_create_adjacency(vertex);
+      }
     }
 
     // From Indexed_iterable<Adjacency>
@@ -100,18 +201,37 @@ namespace ogxx
     auto get(Scalar_index index)      const
       -> See_by<Adjacency_list_entry> override
     {
-      return { index, _adj.at(index).get() };
+      return { index, adjacency_ptr(_adj.at(index)) };
     }
 
     auto set(
-      Scalar_index                  index, 
+      Scalar_index                  index,
       Pass_by<Adjacency_list_entry> value)
         -> Pass_by<Adjacency_list_entry> override
     {
-      if (auto const needed_sz = static_cast<size_t>(index + 1); _adj.size() <= needed_sz)
+      if (auto const needed_sz = static_cast<size_t>(index + 1); _adj.size() < needed_sz)
         _adj.resize(needed_sz);
 
-      _adj[index].reset(value.adjacency);
+      if constexpr (use_arena)
+      {
+        // Only arena objects are kept: copy the items and dispose of the heap object passed.
+        std::unique_ptr<Adjacency> const passed(value.adjacency);
+        Adjacency* copy = nullptr;
+        if (passed)
+        {
+          copy = new_arena_adjacency();
+          auto it = passed->iterate();
+          for (Scalar_index item; it->next(item);)
+            copy->insert(item);
+        }
+
+        _adj[index] = copy;
+      }
+      else
+      {
+        _adj[index].reset(value.adjacency);
+      }
+
       return { index }; // TODO: fail to return the old adjacency.
       // We return nullptr because it is forbidden to
       // transfer ownership by passing an ordinary pointer.
@@ -130,7 +250,7 @@ namespace ogxx
     auto iterate() const
       -> Basic_iterator_uptr<See_by<Adjacency_list_entry>> override
     {
-      return std::make_unique<Adjacency_list_vector_iterator>(_adj);
+      return std::make_unique<Adjacency_list_vector_iterator<Storage>>(_adj);
     }
 
     auto is_empty() const noexcept
@@ -140,7 +260,38 @@ namespace ogxx
     }
 
   private:
-    Adjacency_list_vector_storage _adj;
+    using Storage = std::conditional_t<use_arena,
+      Adjacency_list_arena_storage,
+      Adjacency_list_vector_storage>;
+
+    struct No_arena {};
+
+    /// Declared before _adj to outlive it.
+    [[no_unique_address]] std::conditional_t<use_arena,
+      std::pmr::monotonic_buffer_resource,
+      No_arena>                         _arena;
+    Storage                             _adj;
+
+    /// Arena objects are never destroyed: their only resource is the arena memory itself.
+    auto new_arena_adjacency()
+      -> Adjacency*
+    {
+      std::pmr::polymorphic_allocator<> allocator(&_arena);
+      return allocator.new_object<Adjacency_arena>(&_arena);
+    }
   };
 
+
+  auto new_adjacency_list_vector()
+    -> Adjacency_list_uptr
+  {
+    return std::make_unique<Adjacency_list_vector<false>>();
+  }
+
+  auto new_adjacency_list_vector_arena()
+    -> Adjacency_list_uptr
+  {
+    return std::make_unique<Adjacency_list_vector<true>>();
+  }
+
 }
@@ -0,0 +1,83 @@
+/// @file source/atomic_bitvector.hpp
+/// @brief Fixed-size bit vector with lock-free concurrent bit setting.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_ATOMIC_BITVECTOR_HPP_INCLUDED
+#define OGXX_ATOMIC_BITVECTOR_HPP_INCLUDED
+
+#include <ogxx/primitive_definitions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief Bits in 64-bit words like Index_set_bitvector, but set by atomic OR so that threads may mark items concurrently.
+  class Atomic_bitvector
+  {
+  public:
+    using Word = std::uint64_t;
+    static constexpr Scalar_size word_bits = 64;
+
+    Atomic_bitvector() noexcept = default;
+
+    /// @brief Create size zero bits.
+    explicit Atomic_bitvector(Scalar_size size)
+      : _words((size + word_bits - 1) / word_bits) {}
+
+    /// @brief Clear all the bits keeping the size (not concurrently with other operations).
+    void clear() noexcept
+    {
+      std::fill(_words.begin(), _words.end(), Word{});
+    }
+
+    /// @brief Check a bit.
+    [[nodiscard]] auto test(Scalar_index item) const noexcept
+      -> bool
+    {
+      return load(item / word_bits) & bit(item);
+    }
+
+    /// @brief Set a bit, only one of the threads setting the same bit concurrently gets true.
+    /// The word is read first: a bit already set costs no atomic read-modify-write.
+    /// @return true if the bit has been set by this call, false if it had been set before
+    auto set(Scalar_index item) noexcept
+      -> bool
+    {
+      auto const mask = bit(item);
+      auto& word = _words[item / word_bits];
+      if (std::atomic_ref<Word>(word).load(std::memory_order_relaxed) & mask)
+        return false;
+      return !(std::atomic_ref<Word>(word).fetch_or(mask, std::memory_order_relaxed) & mask);
+    }
+
+    /// @brief Get a word (bits of items word_index * 64 ... word_index * 64 + 63).
+    [[nodiscard]] auto load(Scalar_index word_index) const noexcept
+      -> Word
+    {
+      return std::atomic_ref<Word const>(_words[word_index]).load(std::memory_order_relaxed);
+    }
+
+    /// @brief Get the count of words.
+    [[nodiscard]] auto word_count() const noexcept
+      -> Scalar_size
+    {
+      return static_cast<Scalar_size>(_words.size());
+    }
+
+  private:
+    std::vector<Word> _words;
+
+    [[nodiscard]] static auto bit(Scalar_index item) noexcept
+      -> Word
+    {
+      return Word(1) << (item % word_bits);
+    }
+  };
+
+}
+
+#endif//OGXX_ATOMIC_BITVECTOR_HPP_INCLUDED
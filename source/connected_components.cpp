@@ -0,0 +1,100 @@
+/// @file connected_components.cpp
+/// @brief Parallel connected components (Afforest) implementation.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/connected_components.hpp>
+#include "transposed_csr.hpp"
+
+#include <random>
+#include <unordered_map>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Vertices processed by one task.
+    constexpr Scalar_size components_block = 4096;
+
+    /// Each vertex is united with this many first neighbors before sampling.
+    constexpr Scalar_size neighbor_rounds = 2;
+
+    /// Vertices sampled to find the largest intermediate component.
+    constexpr Scalar_size sample_size = 1024;
+
+
+    /// Call f(v) for all the vertices in parallel by blocks.
+    template <typename F>
+    void for_each_vertex(Scalar_size n, Thread_pool& pool, F&& f)
+    {
+      pool.parallel_for((n + components_block - 1) / components_block, [&](Scalar_index block)
+        {
+          auto const first = block * components_block;
+          auto const last  = min(n, first + components_block);
+          for (auto v = first; v < last; ++v)
+            f(v);
+        });
+    }
+
+    /// The most frequent representative among randomly chosen vertices.
+    auto sample_largest(Concurrent_disjoint_set& sets, Scalar_size n)
+      -> Vertex_index
+    {
+      std::mt19937_64 rng(n);
+      std::uniform_int_distribution<Vertex_index> vertex(0, n - 1);
+      std::unordered_map<Vertex_index, Scalar_size> counts;
+      for (Scalar_index i = 0; i < sample_size; ++i)
+        ++counts[sets.find(vertex(rng))];
+
+      auto best = counts.begin();
+      for (auto it = counts.begin(); it != counts.end(); ++it)
+        if (best->second < it->second)
+          best = it;
+      return best->first;
+    }
+
+  }
+
+
+  auto connected_components(Graph_view const& graph, Thread_pool& pool)
+    -> std::vector<Vertex_index>
+  {
+    auto const n = graph.vertex_count();
+    Adjacency_list_uptr converted;
+    auto const csr = csr_view_or_convert(graph, converted);
+
+    auto const csr_n = min(n, csr.vertex_count());
+    Concurrent_disjoint_set sets(n);
+    for (Scalar_index round = 0; round < neighbor_rounds; ++round)
+    {
+      for_each_vertex(csr_n, pool, [&](Vertex_index v)
+        {
+          auto const neighbors = csr.neighbors(v);
+          if (round < static_cast<Scalar_size>(neighbors.size()))
+            sets.unite(v, neighbors[round]);
+        });
+    }
+
+    // An undirected graph has both the arcs of an edge, so the largest component needs no more work:
+    // an edge leaving it is processed from the other side.
+    auto const skipped = n == 0 || graph.is_directed()? npos: sample_largest(sets, n);
+    for_each_vertex(csr_n, pool, [&](Vertex_index v)
+      {
+        if (skipped != npos && sets.find(v) == skipped)
+          return;
+
+        for (auto u: csr.neighbors(v).subspan(min(neighbor_rounds, csr.degree(v))))
+          sets.unite(v, u);
+      });
+
+    std::vector<Vertex_index> labels(n);
+    for_each_vertex(n, pool, [&](Vertex_index v)
+      {
+        labels[v] = sets.find(v);
+      });
+
+    return labels;
+  }
+
+}
@@ -0,0 +1,363 @@
+/// @file delta_stepping.cpp
+/// @brief Parallel delta-stepping implementation.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/delta_stepping.hpp>
+#include "dense_st_matrix.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Frontier vertices relaxed by one task.
+    constexpr Scalar_size delta_stepping_chunk = 256;
+
+    /// Vertices partitioned into light and heavy arcs by one task.
+    constexpr Scalar_size delta_stepping_rows_per_task = 4096;
+
+    /// The bucket array is cyclic, it covers distances up to the current bucket plus the maximal weight,
+    /// delta is raised if needed to keep its size within this.
+    constexpr Scalar_size delta_stepping_max_buckets = Scalar_size(1) << 16;
+
+
+    /// Arcs of each vertex reordered: light ones (weight <= delta) first.
+    template <typename Weight>
+    struct Split_arcs
+    {
+      std::span<Scalar_index const> offsets;
+      std::vector<Scalar_index>     light_end;
+      std::vector<Vertex_index>     targets;
+      std::vector<Weight>           weights;
+    };
+
+
+    /// Largest weight, throws if a weight is negative.
+    template <typename Weight>
+    auto max_weight(Weighted_csr_view<Weight> const& csr, Thread_pool& pool)
+      -> Weight
+    {
+      auto const arcs  = static_cast<Scalar_size>(csr.weights.size());
+      auto const tasks = (arcs + delta_stepping_rows_per_task - 1) / delta_stepping_rows_per_task;
+      std::vector<Weight> maxima(tasks, Weight{});
+      pool.parallel_for(tasks, [&](Scalar_index task)
+        {
+          auto const first = task * delta_stepping_rows_per_task;
+          auto const last  = min(first + delta_stepping_rows_per_task, arcs);
+          auto result = Weight{};
+          for (auto a = first; a < last; ++a)
+          {
+            auto const w = csr.weights[a];
+            if (w < Weight{})
+              throw std::invalid_argument("delta_stepping: negative weight.");
+            if (w != no_path_length<Weight>)
+              result = max(result, w);
+          }
+
+          maxima[task] = result;
+        });
+
+      return maxima.empty()? Weight{}: *std::max_element(maxima.begin(), maxima.end());
+    }
+
+
+    template <typename Weight>
+    auto split_arcs(Weighted_csr_view<Weight> const& csr, Weight delta, Thread_pool& pool)
+      -> Split_arcs<Weight>
+    {
+      auto const n = csr.vertex_count();
+      Split_arcs<Weight> split;
+      split.offsets = csr.offsets;
+      split.light_end.resize(n);
+      split.targets.resize(csr.targets.size());
+      split.weights.resize(csr.weights.size());
+
+      auto const tasks = (n + delta_stepping_rows_per_task - 1) / delta_stepping_rows_per_task;
+      pool.parallel_for(tasks, [&](Scalar_index task)
+        {
+          auto const first = task * delta_stepping_rows_per_task;
+          for (auto u = first, last = min(first + delta_stepping_rows_per_task, n); u < last; ++u)
+          {
+            auto light = csr.offsets[u], heavy = csr.offsets[u + 1];
+            for (auto a = csr.offsets[u], a_end = csr.offsets[u + 1]; a < a_end; ++a)
+            {
+              auto const at = csr.weights[a] <= delta? light++: --heavy;
+              split.targets[at] = csr.targets[a];
+              split.weights[at] = csr.weights[a];
+            }
+
+            split.light_end[u] = light;
+          }
+        });
+
+      return split;
+    }
+
+
+    /// Bucket index of a distance.
+    inline auto bucket_of(Int distance, Int delta) noexcept
+      -> Scalar_index
+    {
+      return distance / delta;
+    }
+
+    inline auto bucket_of(Float distance, Float delta) noexcept
+      -> Scalar_index
+    {
+      return static_cast<Scalar_index>(min(distance / delta, 0x1p62));
+    }
+
+    /// Path length through an arc, no_path_length if it overflows.
+    inline auto add_length(Int distance, Int weight) noexcept
+      -> Int
+    {
+      auto const sum = std::int64_t(distance) + weight;
+      return sum < int_infinity? static_cast<Int>(sum): int_infinity;
+    }
+
+    inline auto add_length(Float distance, Float weight) noexcept
+      -> Float
+    {
+      return distance + weight;
+    }
+
+    /// Atomically lower the distance, true if it has been lowered.
+    template <typename Weight>
+    auto fetch_min(Weight& distance, Weight value) noexcept
+      -> bool
+    {
+      std::atomic_ref<Weight> ref(distance);
+      auto current = ref.load(std::memory_order_relaxed);
+      while (value < current)
+        if (ref.compare_exchange_weak(current, value, std::memory_order_relaxed))
+          return true;
+      return false;
+    }
+
+
+    template <typename Weight>
+    class Delta_stepping
+    {
+    public:
+      Delta_stepping(Split_arcs<Weight> const& arcs, Weight delta, Scalar_size bucket_count,
+          std::span<Weight> distances, Thread_pool& pool)
+        : _arcs(arcs)
+        , _delta(delta)
+        , _distances(distances)
+        , _pool(pool)
+        , _buckets(bucket_count)
+        , _queued(arcs.light_end.size(), npos)
+        , _removed(arcs.light_end.size(), npos) {}
+
+      void run(Vertex_index source)
+      {
+        std::fill(_distances.begin(), _distances.end(), no_path_length<Weight>);
+        _distances[source] = Weight{};
+        enqueue(source);
+
+        std::vector<Vertex_index> frontier, removed;
+        for (Scalar_index current = 0; _pending > 0; ++current)
+        {
+          auto& bucket = _buckets[current % _buckets.size()];
+          removed.clear();
+          while (!bucket.empty())
+          {
+            frontier.clear();
+            frontier.swap(bucket);
+            std::erase_if(frontier, [&](Vertex_index v)
+              {
+                if (_queued[v] != current)
+                  return true; // moved to another bucket or already taken
+
+                _queued[v] = npos;
+                --_pending;
+                if (_removed[v] != current)
+                {
+                  _removed[v] = current;
+                  removed.push_back(v);
+                }
+
+                return false;
+              });
+
+            relax<true>(frontier);
+          }
+
+          relax<false>(removed);
+        }
+      }
+
+    private:
+      Split_arcs<Weight> const&               _arcs;
+      Weight                                  _delta;
+      std::span<Weight>                       _distances;
+      Thread_pool&                            _pool;
+      std::vector<std::vector<Vertex_index>>  _buckets;
+      std::vector<Scalar_index>               _queued;   ///< the bucket of the vertex or npos
+      std::vector<Scalar_index>               _removed;  ///< the last bucket the vertex has been taken from
+      std::vector<std::vector<Vertex_index>>  _improved; ///< vertices with lowered distances per task
+      Scalar_size                             _pending = 0;
+
+      void enqueue(Vertex_index v)
+      {
+        auto const b = bucket_of(_distances[v], _delta);
+        if (_queued[v] == b)
+          return;
+
+        if (_queued[v] == npos)
+          ++_pending;
+        _queued[v] = b;
+        _buckets[b % _buckets.size()].push_back(v);
+      }
+
+      /// Relax light or heavy arcs of the vertices in parallel, then put the improved vertices to their buckets.
+      template <bool light>
+      void relax(std::span<Vertex_index const> vertices)
+      {
+        auto const count = static_cast<Scalar_size>(vertices.size());
+        auto const tasks = (count + delta_stepping_chunk - 1) / delta_stepping_chunk;
+        if (static_cast<Scalar_size>(_improved.size()) < tasks)
+          _improved.resize(tasks);
+
+        _pool.parallel_for(tasks, [&](Scalar_index task)
+          {
+            auto& improved = _improved[task];
+            improved.clear();
+
+            auto const first = task * delta_stepping_chunk;
+            for (auto i = first, last = min(first + delta_stepping_chunk, count); i < last; ++i)
+            {
+              auto const u  = vertices[i];
+              auto const du = std::atomic_ref<Weight>(_distances[u]).load(std::memory_order_relaxed);
+              auto const a0 = light? _arcs.offsets[u]: _arcs.light_end[u];
+              auto const a1 = light? _arcs.light_end[u]: _arcs.offsets[u + 1];
+              for (auto a = a0; a < a1; ++a)
+              {
+                auto const v = _arcs.targets[a];
+                if (fetch_min(_distances[v], add_length(du, _arcs.weights[a])))
+                  improved.push_back(v);
+              }
+            }
+          });
+
+        for (Scalar_index task = 0; task < tasks; ++task)
+          for (auto v: _improved[task])
+            enqueue(v);
+      }
+    };
+
+
+    template <typename Weight>
+    void delta_stepping_W(Weighted_graph_view<Weight> const& graph, Vertex_index source,
+        std::span<Weight> distances, Thread_pool& pool, Weight delta)
+    {
+      auto const csr = graph.weighted_csr();
+      auto const n   = csr.vertex_count();
+      if (source < 0 || n <= source)
+        throw std::out_of_range("delta_stepping: source vertex index out of range.");
+      if (static_cast<Scalar_size>(distances.size()) < n)
+        throw std::invalid_argument("delta_stepping: distances are less than the vertex count.");
+      if (delta < Weight{})
+        throw std::invalid_argument("delta_stepping: negative delta.");
+
+      auto const heaviest = max_weight(csr, pool);
+      if (delta == Weight{})
+      {
+        auto const average_degree = max(Scalar_size(1), static_cast<Scalar_size>(csr.targets.size()) / n);
+        delta = static_cast<Weight>(heaviest / static_cast<Weight>(average_degree));
+      }
+
+      if constexpr (std::is_same_v<Weight, Int>)
+      {
+        delta = max(delta, Int(heaviest / delta_stepping_max_buckets + 1));
+      }
+      else
+      {
+        delta = max(delta, heaviest / delta_stepping_max_buckets);
+        if (!(delta > 0) || !std::isfinite(delta))
+          delta = max(Float(1), heaviest);
+      }
+
+      auto const bucket_count = bucket_of(heaviest, delta) + 2;
+      auto const arcs = split_arcs(csr, delta, pool);
+      Delta_stepping<Weight>(arcs, delta, bucket_count, distances.first(n), pool).run(source);
+    }
+
+
+    template <typename Weight>
+    void delta_stepping_row(Weighted_graph_view<Weight> const& graph, Vertex_index source,
+        St_matrix<Weight>& distances, Scalar_index row, Thread_pool& pool, Weight delta)
+    {
+      auto const shape = distances.shape();
+      auto const n     = graph.vertex_count();
+      if (row < 0 || shape.rows <= row)
+        throw std::out_of_range("delta_stepping: row index out of range.");
+      if (shape.cols < n)
+        throw std::invalid_argument("delta_stepping: the matrix row is less than the vertex count.");
+
+      if (auto const dense = dynamic_cast<Dense_st_matrix<Weight>*>(&distances))
+      {
+        delta_stepping_W(graph, source, std::span(dense->data() + row * shape.cols, n), pool, delta);
+        return;
+      }
+
+      std::vector<Weight> buffer(n);
+      delta_stepping_W(graph, source, std::span(buffer), pool, delta);
+      for (Vertex_index v = 0; v < n; ++v)
+        distances.set(row, v, buffer[v]);
+    }
+
+  }
+
+
+  void delta_stepping(Int_weighted_graph_view const& graph, Vertex_index source,
+      std::span<Int> distances, Thread_pool& pool, Int delta)
+  {
+    delta_stepping_W(graph, source, distances, pool, delta);
+  }
+
+  void delta_stepping(Float_weighted_graph_view const& graph, Vertex_index source,
+      std::span<Float> distances, Thread_pool& pool, Float delta)
+  {
+    delta_stepping_W(graph, source, distances, pool, delta);
+  }
+
+
+  void delta_stepping(Int_weighted_graph_view const& graph, Vertex_index source,
+      Int_matrix& distances, Scalar_index row, Thread_pool& pool, Int delta)
+  {
+    delta_stepping_row(graph, source, distances, row, pool, delta);
+  }
+
+  void delta_stepping(Float_weighted_graph_view const& graph, Vertex_index source,
+      Float_matrix& distances, Scalar_index row, Thread_pool& pool, Float delta)
+  {
+    delta_stepping_row(graph, source, distances, row, pool, delta);
+  }
+
+
+  auto delta_stepping(Int_weighted_graph_view const& graph, Vertex_index source,
+      Thread_pool& pool, Int delta)
+    -> std::vector<Int>
+  {
+    std::vector<Int> distances(graph.vertex_count());
+    delta_stepping_W(graph, source, std::span(distances), pool, delta);
+    return distances;
+  }
+
+  auto delta_stepping(Float_weighted_graph_view const& graph, Vertex_index source,
+      Thread_pool& pool, Float delta)
+    -> std::vector<Float>
+  {
+    std::vector<Float> distances(graph.vertex_count());
+    delta_stepping_W(graph, source, std::span(distances), pool, delta);
+    return distances;
+  }
+
+}
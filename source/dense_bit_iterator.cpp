@@ -3,6 +3,7 @@
 /// @author Tsay A.
 #include <ogxx/iterator.hpp>
 #include <climits>
+#include <algorithm>
 
 namespace ogxx
 {
@@ -31,6 +32,22 @@ namespace ogxx
           return true;
       }
 
+      /// @brief 'next_batch' method: loads each word once for all the bits taken from it
+      Scalar_size next_batch(std::span<bool> values) noexcept override {
+          Scalar_size written = 0;
+          auto const  count   = static_cast<Scalar_size>(values.size());
+          while (written < count && currentbit < endbit)
+          {
+              auto const word_index = currentbit / word_bits;
+              auto const bits       = word[word_index];
+              auto const word_end   = std::min(endbit, (word_index + 1) * word_bits);
+              for (; written < count && currentbit < word_end; currentbit += stride)
+                  values[written++] = (bits >> (currentbit % word_bits)) & 1;
+          }
+
+          return written;
+      }
+
   private:
       unsigned const* word;
       size_t currentbit;
@@ -0,0 +1,256 @@
+/// @file dijkstra.cpp
+/// @brief Dijkstra's algorithm implementation.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/dijkstra.hpp>
+#include "dijkstra_heaps.hpp"
+#include "min_plus.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace ogxx
+{
+
+  template <typename Weight>
+  struct Dijkstra_workspace<Weight>::State
+  {
+    /// What a run knows about a vertex: valid only if mark is one of the marks of the last run.
+    struct Vertex_state
+    {
+      Weight        distance;
+      Vertex_index  parent;
+      std::uint32_t mark;
+    };
+
+    Dijkstra_heap               heap;
+    std::vector<Vertex_state>   vertices;
+    Scalar_size                 vertex_count  = 0;
+    std::uint32_t               reached       = 0; ///< mark of the vertices in the heap, reached + 1 marks the settled ones
+
+    Indexed_dary_heap<Weight>   d_ary;
+    Radix_heap<std::uint32_t>   radix;
+
+    /// Get fresh marks, the marks of the past runs are all less than them.
+    void start(Scalar_size count)
+    {
+      if (static_cast<Scalar_size>(vertices.size()) < count)
+        vertices.resize(count, Vertex_state{ Weight{}, npos, 0 });
+
+      if (reached >= std::numeric_limits<std::uint32_t>::max() - 2)
+      {
+        for (auto& vertex: vertices)
+          vertex.mark = 0;
+        reached = 0;
+      }
+
+      reached += 2;
+      vertex_count = count;
+    }
+
+    [[nodiscard]] auto is_settled(Vertex_index vertex) const noexcept
+      -> bool
+    {
+      return 0 <= vertex && vertex < vertex_count && vertices[vertex].mark == reached + 1;
+    }
+
+    template <typename Heap, typename To_key>
+    auto search(Heap& queue, Weighted_csr_view<Weight> const& csr,
+        Vertex_index source, Vertex_index target, To_key to_key)
+      -> Weight
+    {
+      auto const settled = reached + 1;
+      queue.reset(vertex_count);
+      vertices[source] = { Weight{}, npos, reached };
+      queue.push(source, to_key(Weight{}));
+
+      while (!queue.is_empty())
+      {
+        auto const u  = queue.pop().vertex;
+        auto& state_u = vertices[u];
+        if (state_u.mark == settled)
+          continue; // stale entry of the radix heap
+
+        state_u.mark = settled;
+        if (u == target)
+          return state_u.distance;
+
+        auto const du = state_u.distance;
+        auto const [targets, weights] = csr.weighted_neighbors(u);
+        for (Scalar_index a = 0, degree = static_cast<Scalar_index>(targets.size()); a < degree; ++a)
+        {
+          auto const v = targets[a];
+          auto const w = weights[a];
+          if (w < Weight{})
+            throw std::invalid_argument("Dijkstra_workspace::run: negative weight.");
+
+          auto& state_v = vertices[v];
+          if (state_v.mark == settled)
+            continue;
+
+          auto const dv = saturating_add(du, w);
+          if (state_v.mark != reached)
+          {
+            if (dv == no_path_length<Weight>)
+              continue;
+
+            state_v = { dv, u, reached };
+            queue.update(v, to_key(dv), true);
+          }
+          else if (dv < state_v.distance)
+          {
+            state_v.distance = dv;
+            state_v.parent   = u;
+            queue.update(v, to_key(dv), false);
+          }
+        }
+      }
+
+      return no_path_length<Weight>;
+    }
+  };
+
+
+  template <typename Weight>
+  Dijkstra_workspace<Weight>::Dijkstra_workspace(Dijkstra_heap heap)
+    : _state(std::make_unique<State>())
+  {
+    if (heap == Dijkstra_heap::automatic)
+      heap = std::is_same_v<Weight, Int>? Dijkstra_heap::radix: Dijkstra_heap::d_ary;
+
+    if (heap == Dijkstra_heap::radix && !std::is_same_v<Weight, Int>)
+      throw std::invalid_argument("Dijkstra_workspace: radix heap needs Int weights.");
+
+    _state->heap = heap;
+  }
+
+  template <typename Weight>
+  Dijkstra_workspace<Weight>::~Dijkstra_workspace() = default;
+
+  template <typename Weight>
+  Dijkstra_workspace<Weight>::Dijkstra_workspace(Dijkstra_workspace&&) noexcept = default;
+
+  template <typename Weight>
+  auto Dijkstra_workspace<Weight>::operator=(Dijkstra_workspace&&) noexcept
+    -> Dijkstra_workspace& = default;
+
+
+  template <typename Weight>
+  auto Dijkstra_workspace<Weight>::heap() const noexcept
+    -> Dijkstra_heap
+  {
+    return _state->heap;
+  }
+
+
+  template <typename Weight>
+  auto Dijkstra_workspace<Weight>::run(Weighted_graph_view<Weight> const& graph, Vertex_index source, Vertex_index target)
+    -> Weight
+  {
+    auto const csr = graph.weighted_csr();
+    auto const n   = csr.vertex_count();
+    if (source < 0 || n <= source || target < npos || n <= target)
+      throw std::out_of_range("Dijkstra_workspace::run: vertex index out of range.");
+
+    auto& state = *_state;
+    state.start(n);
+
+    if constexpr (std::is_same_v<Weight, Int>)
+    {
+      if (state.heap == Dijkstra_heap::radix)
+        return state.search(state.radix, csr, source, target,
+          [](Int distance) { return static_cast<std::uint32_t>(distance); });
+    }
+
+    return state.search(state.d_ary, csr, source, target,
+      [](Weight distance) { return distance; });
+  }
+
+
+  template <typename Weight>
+  auto Dijkstra_workspace<Weight>::distance(Vertex_index vertex) const noexcept
+    -> Weight
+  {
+    return _state->is_settled(vertex)? _state->vertices[vertex].distance: no_path_length<Weight>;
+  }
+
+  template <typename Weight>
+  auto Dijkstra_workspace<Weight>::parent(Vertex_index vertex) const noexcept
+    -> Vertex_index
+  {
+    return _state->is_settled(vertex)? _state->vertices[vertex].parent: npos;
+  }
+
+  template <typename Weight>
+  auto Dijkstra_workspace<Weight>::path(Vertex_index target, std::vector<Vertex_index>& path) const
+    -> bool
+  {
+    path.clear();
+    if (!_state->is_settled(target))
+      return false;
+
+    for (auto v = target; v != npos; v = _state->vertices[v].parent)
+      path.push_back(v);
+
+    std::reverse(path.begin(), path.end());
+    return true;
+  }
+
+
+  template class Dijkstra_workspace<Int>;
+  template class Dijkstra_workspace<Float>;
+
+
+  namespace
+  {
+
+    template <typename Weight>
+    auto local_workspace()
+      -> Dijkstra_workspace<Weight>&
+    {
+      thread_local Dijkstra_workspace<Weight> workspace;
+      return workspace;
+    }
+
+    template <typename Weight>
+    auto dijkstra_W(Weighted_graph_view<Weight> const& graph, Vertex_index source)
+      -> std::vector<Weight>
+    {
+      auto& workspace = local_workspace<Weight>();
+      (void)workspace.run(graph, source);
+
+      std::vector<Weight> distances(graph.vertex_count());
+      for (Vertex_index v = 0; v < static_cast<Vertex_index>(distances.size()); ++v)
+        distances[v] = workspace.distance(v);
+      return distances;
+    }
+
+  }
+
+
+  auto dijkstra(Int_weighted_graph_view const& graph, Vertex_index source)
+    -> std::vector<Int>
+  {
+    return dijkstra_W(graph, source);
+  }
+
+  auto dijkstra(Float_weighted_graph_view const& graph, Vertex_index source)
+    -> std::vector<Float>
+  {
+    return dijkstra_W(graph, source);
+  }
+
+
+  auto shortest_path_length(Int_weighted_graph_view const& graph, Vertex_index from, Vertex_index to)
+    -> Int
+  {
+    return local_workspace<Int>().run(graph, from, to);
+  }
+
+  auto shortest_path_length(Float_weighted_graph_view const& graph, Vertex_index from, Vertex_index to)
+    -> Float
+  {
+    return local_workspace<Float>().run(graph, from, to);
+  }
+
+}
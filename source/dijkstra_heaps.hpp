@@ -0,0 +1,214 @@
+/// @file source/dijkstra_heaps.hpp
+/// @brief Vertex priority queues for Dijkstra-like algorithms: an indexed d-ary heap and a monotone radix heap.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_DIJKSTRA_HEAPS_HPP_INCLUDED
+#define OGXX_DIJKSTRA_HEAPS_HPP_INCLUDED
+
+#include <ogxx/vertex_pair.hpp>
+
+#include <array>
+#include <bit>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief A vertex with its priority.
+  template <typename Key>
+  struct Heap_entry
+  {
+    Key           key;
+    Vertex_index  vertex;
+  };
+
+
+  /// @brief Min-heap of vertices with arity children per node, the position of each vertex is tracked for decrease-key.
+  /// Positions of the vertices not in the heap are garbage, the user knows which vertices are in the heap.
+  template <typename Key, Scalar_size arity = 4>
+  class Indexed_dary_heap
+  {
+  public:
+    using Entry = Heap_entry<Key>;
+
+    /// @brief Make the heap empty and ready for vertex indices below vertex_count, keeps the memory.
+    void reset(Scalar_size vertex_count)
+    {
+      _entries.clear();
+      if (static_cast<Scalar_size>(_position.size()) < vertex_count)
+        _position.resize(vertex_count);
+    }
+
+    [[nodiscard]] auto is_empty() const noexcept
+      -> bool { return _entries.empty(); }
+
+    /// @brief Insert a vertex not in the heap.
+    void push(Vertex_index vertex, Key key)
+    {
+      _entries.push_back({ key, vertex });
+      sift_up(static_cast<Scalar_index>(_entries.size()) - 1);
+    }
+
+    /// @brief Lower the key of a vertex in the heap.
+    void decrease(Vertex_index vertex, Key key) noexcept
+    {
+      auto const at = _position[vertex];
+      _entries[at].key = key;
+      sift_up(at);
+    }
+
+    /// @brief Push a reached vertex or decrease the key of a vertex in the heap.
+    void update(Vertex_index vertex, Key key, bool is_new)
+    {
+      if (is_new)
+        push(vertex, key);
+      else
+        decrease(vertex, key);
+    }
+
+    /// @brief Remove and return the entry with the least key, the heap must not be empty.
+    auto pop() noexcept
+      -> Entry
+    {
+      auto const top  = _entries.front();
+      auto const last = _entries.back();
+      _entries.pop_back();
+      if (!_entries.empty())
+        sift_down(last);
+      return top;
+    }
+
+  private:
+    std::vector<Entry>        _entries;
+    std::vector<Scalar_index> _position;
+
+    void place(Scalar_index at, Entry entry) noexcept
+    {
+      _entries[at] = entry;
+      _position[entry.vertex] = at;
+    }
+
+    void sift_up(Scalar_index at) noexcept
+    {
+      auto const entry = _entries[at];
+      while (at > 0)
+      {
+        auto const up = (at - 1) / arity;
+        if (!(entry.key < _entries[up].key))
+          break;
+
+        place(at, _entries[up]);
+        at = up;
+      }
+
+      place(at, entry);
+    }
+
+    /// Put entry to the root moving it down.
+    void sift_down(Entry entry) noexcept
+    {
+      auto const size = static_cast<Scalar_index>(_entries.size());
+      Scalar_index at = 0;
+      for (;;)
+      {
+        auto const first = at * arity + 1;
+        if (first >= size)
+          break;
+
+        auto best = first;
+        for (auto child = first + 1, last = min(first + arity, size); child < last; ++child)
+          if (_entries[child].key < _entries[best].key)
+            best = child;
+
+        if (!(_entries[best].key < entry.key))
+          break;
+
+        place(at, _entries[best]);
+        at = best;
+      }
+
+      place(at, entry);
+    }
+  };
+
+
+  /// @brief Monotone priority queue of vertices with unsigned integer keys:
+  /// a pushed key must not be less than the last popped one.
+  /// Bucket b holds the keys differing from the last popped key in the bit b - 1 at most (bucket 0 holds keys equal to it),
+  /// an entry moves to a lower bucket at most bit count times, so pop takes O(log C) amortized for keys below C.
+  /// Decrease-key pushes the vertex again, the user skips the stale entries.
+  template <typename Key>
+  class Radix_heap
+  {
+    static_assert(std::is_unsigned_v<Key>);
+
+  public:
+    using Entry = Heap_entry<Key>;
+
+    /// @brief Make the heap empty, keeps the memory.
+    void reset(Scalar_size = 0) noexcept
+    {
+      for (auto& bucket: _buckets)
+        bucket.clear();
+      _last = 0;
+      _size = 0;
+    }
+
+    [[nodiscard]] auto is_empty() const noexcept
+      -> bool { return _size == 0; }
+
+    /// @brief Insert a vertex, key must not be less than the last popped key.
+    void push(Vertex_index vertex, Key key)
+    {
+      _buckets[bucket_of(key)].push_back({ key, vertex });
+      ++_size;
+    }
+
+    /// @brief Push a vertex (the old entry of a decreased key stays in the heap).
+    void update(Vertex_index vertex, Key key, bool)
+    {
+      push(vertex, key);
+    }
+
+    /// @brief Remove and return an entry with the least key, the heap must not be empty.
+    auto pop()
+      -> Entry
+    {
+      if (_buckets[0].empty())
+      {
+        auto b = 1;
+        while (_buckets[b].empty())
+          ++b;
+
+        // The least key of the bucket becomes the last one, all its entries go to lower buckets.
+        auto& bucket = _buckets[b];
+        _last = bucket.front().key;
+        for (auto const& entry: bucket)
+          _last = min(_last, entry.key);
+
+        for (auto const& entry: bucket)
+          _buckets[bucket_of(entry.key)].push_back(entry);
+        bucket.clear();
+      }
+
+      --_size;
+      auto const top = _buckets[0].back();
+      _buckets[0].pop_back();
+      return top;
+    }
+
+  private:
+    std::array<std::vector<Entry>, std::numeric_limits<Key>::digits + 1> _buckets;
+    Key         _last = 0;
+    Scalar_size _size = 0;
+
+    [[nodiscard]] auto bucket_of(Key key) const noexcept
+      -> Scalar_index
+    {
+      return std::bit_width(static_cast<Key>(key ^ _last));
+    }
+  };
+
+}
+
+#endif//OGXX_DIJKSTRA_HEAPS_HPP_INCLUDED
@@ -1,49 +1,36 @@
 /// @file edge_list_hashtable.cpp
-/// @brief Edge_list implementation based upon std::unordered_set.
+/// @brief Edge_list implementation based upon a flat open-addressing hash set.
+
+#include "flat_hash_set.hpp"
 
 #include <ogxx/edge_list.hpp>
 #include <ogxx/st_set.hpp>
 
-#include <ogxx/stl_iterator.hpp>
-
-#include <unordered_set>
 #include <algorithm>
 
 
-// Define the hash function for Vertex_pair
-namespace {
-    struct Vertex_pair_hash {
-        auto operator()(const ogxx::Vertex_pair& p) const noexcept -> size_t {
-            std::hash<ogxx::Scalar_index> h;
-            auto const h1 = h(p.first), h2 = h(p.second);
-            return (h1 << 13) ^ (h1 >> 17) ^ h2;
-        }
-    };
-}
-
 namespace ogxx {
 
+    using Vertex_pair_set = Flat_hash_set<Vertex_pair, Pair_hash>;
+    using Vertex_pair_set_iterator = Flat_hash_set_iterator<Vertex_pair_set, Vertex_pair>;
+
     class Edge_list_hashtable : public Edge_list, public St_set<Vertex_pair> {
     public:
         auto contains(Vertex_pair item) const noexcept -> bool override {
-            return edges.count(item) > 0;
+            return edges.contains(item);
         }
 
         auto insert(Vertex_pair item) -> bool override {
-            auto [iter, inserted] = edges.insert(item);
-            return inserted;
+            return edges.insert(item);
         }
 
         auto erase(Vertex_pair item) -> bool override {
-            return edges.erase(item) > 0;
+            return edges.erase(item);
         }
 
+        /// Returns the slot index of the edge in O(1), it is stable until an insert makes the table grow.
         auto find(Vertex_pair edge) const noexcept -> Scalar_index override {
-            auto iter = edges.find(edge);
-            if (iter != edges.end()) {
-                return std::distance(edges.begin(), iter);
-            }
-            return npos;
+            return edges.find(edge);
         }
 
         auto max_vertex_index() const noexcept -> Vertex_index override {
@@ -52,22 +39,30 @@ namespace ogxx {
             }
 
             Vertex_index max_index = 0;
-            for (auto [u, v]: edges)
+            for (auto slot = edges.next_full(0); slot != edges.capacity(); slot = edges.next_full(slot + 1)) {
+                auto [u, v] = edges.at(slot);
                 max_index = std::max({max_index, u, v});
+            }
 
             return max_index;
         }
 
         void put(Pass_by<Vertex_pair> item) override {
-            edges.emplace(item);
+            edges.insert(item);
         }
 
         auto take() -> Pass_by<Vertex_pair> override {
             Vertex_pair result { npos, npos };
 
             if (!edges.empty()) {
-                result = *edges.begin();
-                edges.erase(edges.begin());
+                // Continue from the last taken slot, so taking all the edges one by one is linear.
+                auto slot = edges.next_full(take_from);
+                if (slot == edges.capacity())
+                    slot = edges.next_full(0);
+
+                result    = edges.at(slot);
+                take_from = slot;
+                edges.erase_at(slot);
             }
 
             return result;
@@ -82,7 +77,11 @@ namespace ogxx {
         }
 
         auto iterate() const -> Vertex_pair_iterator_uptr override {
-            return new_stl_iterator(edges);
+            return std::make_unique<Vertex_pair_set_iterator>(edges);
+        }
+
+        auto iterate_handle() const -> Vertex_pair_iterator_handle override {
+            return make_iterator_handle<Vertex_pair_set_iterator>(edges);
         }
 
         auto is_empty() const noexcept -> bool override {
@@ -92,16 +91,20 @@ namespace ogxx {
 
         Edge_list_hashtable() = default;
 
-        Edge_list_hashtable(std::initializer_list<Vertex_pair> vp_il)
-            : edges(vp_il) {}
+        Edge_list_hashtable(std::initializer_list<Vertex_pair> vp_il) {
+            edges.reserve(vp_il.size());
+            for (auto vp: vp_il)
+                edges.insert(vp);
+        }
 
         explicit Edge_list_hashtable(Vertex_pair_iterator_uptr vp_it) {
             for (Vertex_pair vp; vp_it->next(vp);)
-                edges.emplace(vp);
+                edges.insert(vp);
         }
 
     private:
-        std::unordered_set<Vertex_pair, Vertex_pair_hash> edges;
+        Vertex_pair_set edges;
+        Scalar_index    take_from = 0;
     };
 
 
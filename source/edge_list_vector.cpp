@@ -125,6 +125,12 @@ namespace ogxx
             return new_stl_iterator(_edges);
         }
 
+        auto iterate_handle() const
+            -> Vertex_pair_iterator_handle override
+        {
+            return make_stl_iterator_handle(_edges);
+        }
+
         auto is_empty() const noexcept
             -> bool override
         {
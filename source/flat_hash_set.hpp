@@ -0,0 +1,403 @@
+/// @file source/flat_hash_set.hpp
+/// @brief Flat open-addressing hash set with control bytes probed a group at a time (Swiss table style).
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_FLAT_HASH_SET_HPP_INCLUDED
+#define OGXX_FLAT_HASH_SET_HPP_INCLUDED
+
+#include <ogxx/iterator.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OGXX_FLAT_HASH_SET_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__SIZEOF_INT128__)
+#include <intrin.h>
+#endif
+
+
+namespace ogxx
+{
+
+  /// @brief Mix two 64-bit words into one: fold the 128-bit product of the words xored with odd constants.
+  /// Every input bit affects all the output bits, so both the low (control byte) and the high (position) hash bits are good.
+  [[nodiscard]] inline auto hash_mix(std::uint64_t a, std::uint64_t b) noexcept
+    -> std::uint64_t
+  {
+    a ^= 0xa0761d6478bd642full;
+    b ^= 0xe7037ed1a0b428dbull;
+
+#if defined(__SIZEOF_INT128__)
+    auto const product = static_cast<unsigned __int128>(a) * b;
+    return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    std::uint64_t high;
+    auto const low = _umul128(a, b, &high);
+    return low ^ high;
+#else
+    auto const a_lo = a & 0xffffffffu, a_hi = a >> 32;
+    auto const b_lo = b & 0xffffffffu, b_hi = b >> 32;
+    auto const lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo;
+    auto const lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+    auto const cross = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+    auto const low   = (cross << 32) | (lo_lo & 0xffffffffu);
+    auto const high  = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    return low ^ high;
+#endif
+  }
+
+
+  /// @brief Hash of a pair of 64-bit (or shorter) integers.
+  struct Pair_hash
+  {
+    template <typename A, typename B>
+    [[nodiscard]] auto operator()(std::pair<A, B> const& p) const noexcept
+      -> std::uint64_t
+    {
+      return hash_mix(static_cast<std::uint64_t>(p.first), static_cast<std::uint64_t>(p.second));
+    }
+  };
+
+
+  /// @brief Control bytes of 16 consecutive slots examined at once (with SSE2 if available).
+  class Flat_hash_group
+  {
+  public:
+    static constexpr std::size_t width = 16;
+
+    static constexpr std::uint8_t empty   = 0x80; ///< the slot is free and ends probe sequences
+    static constexpr std::uint8_t deleted = 0xfe; ///< the slot is free but probe sequences go on past it
+                                                  ///  full slots keep 7 bits of the hash: 0x00 ... 0x7f
+
+    explicit Flat_hash_group(std::uint8_t const* ctrl) noexcept
+#ifdef OGXX_FLAT_HASH_SET_SSE2
+      : _ctrl(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl))) {}
+#else
+      : _ctrl(ctrl) {}
+#endif
+
+    /// @brief Bit mask of the slots whose control byte equals h2.
+    [[nodiscard]] auto match(std::uint8_t h2) const noexcept
+      -> std::uint32_t
+    {
+#ifdef OGXX_FLAT_HASH_SET_SSE2
+      return static_cast<std::uint32_t>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_ctrl, _mm_set1_epi8(static_cast<char>(h2)))));
+#else
+      std::uint32_t result = 0;
+      for (std::size_t i = 0; i < width; ++i)
+        result |= std::uint32_t(_ctrl[i] == h2) << i;
+      return result;
+#endif
+    }
+
+    /// @brief Bit mask of the empty slots.
+    [[nodiscard]] auto match_empty() const noexcept
+      -> std::uint32_t
+    {
+      return match(empty);
+    }
+
+    /// @brief Bit mask of the free slots (empty or deleted, i.e. with the high bit set).
+    [[nodiscard]] auto match_free() const noexcept
+      -> std::uint32_t
+    {
+#ifdef OGXX_FLAT_HASH_SET_SSE2
+      return static_cast<std::uint32_t>(_mm_movemask_epi8(_ctrl));
+#else
+      std::uint32_t result = 0;
+      for (std::size_t i = 0; i < width; ++i)
+        result |= std::uint32_t(_ctrl[i] >> 7) << i;
+      return result;
+#endif
+    }
+
+    /// @brief Bit mask of the full slots.
+    [[nodiscard]] auto match_full() const noexcept
+      -> std::uint32_t
+    {
+      return ~match_free() & 0xffffu;
+    }
+
+  private:
+#ifdef OGXX_FLAT_HASH_SET_SSE2
+    __m128i _ctrl;
+#else
+    std::uint8_t const* _ctrl;
+#endif
+  };
+
+
+  /// @brief Open-addressing hash set keeping keys in one flat slot array and one control byte per slot.
+  /// Probing goes group by group (see Flat_hash_group) along a triangular sequence of groups.
+  /// Slot indices of keys are stable until the table is rehashed (i.e. until an insert makes it grow).
+  /// @tparam Key   trivially copyable key type
+  /// @tparam Hash  hash function object type returning 64-bit hashes
+  /// @tparam Equal key equality function object type
+  template <typename Key, typename Hash, typename Equal = std::equal_to<Key>>
+  class Flat_hash_set
+  {
+  public:
+    using Group = Flat_hash_group;
+
+    Flat_hash_set() noexcept = default;
+
+    /// @brief Get the count of keys.
+    [[nodiscard]] auto size() const noexcept
+      -> Scalar_size { return _size; }
+
+    /// @brief Check if there are no keys.
+    [[nodiscard]] auto empty() const noexcept
+      -> bool { return _size == 0; }
+
+    /// @brief Get the count of slots.
+    [[nodiscard]] auto capacity() const noexcept
+      -> Scalar_size { return static_cast<Scalar_size>(_slots.size()); }
+
+    /// @brief Check if the slot holds a key.
+    [[nodiscard]] auto is_full(Scalar_index slot) const noexcept
+      -> bool { return (_ctrl[slot] & Group::empty) == 0; }
+
+    /// @brief Get the key in a full slot.
+    [[nodiscard]] auto at(Scalar_index slot) const noexcept
+      -> Key const& { return _slots[slot]; }
+
+    /// @brief Find the first full slot with index >= from.
+    /// @return the slot index or capacity() if there is none
+    [[nodiscard]] auto next_full(Scalar_index from) const noexcept
+      -> Scalar_index
+    {
+      auto const cap = capacity();
+      while (from < cap)
+      {
+        auto const group_start = from & ~Scalar_index(Group::width - 1);
+        auto const mask = Group(_ctrl.data() + group_start).match_full()
+                        >> (from - group_start) << (from - group_start);
+        if (mask != 0)
+          return group_start + std::countr_zero(mask);
+
+        from = group_start + Group::width;
+      }
+
+      return cap;
+    }
+
+    /// @brief Find the slot of a key.
+    /// @return the slot index or npos if the key is absent
+    [[nodiscard]] auto find(Key const& key) const noexcept
+      -> Scalar_index
+    {
+      if (_slots.empty())
+        return npos;
+
+      auto const hash = Hash{}(key);
+      auto const h2   = static_cast<std::uint8_t>(hash & 0x7f);
+      auto const mask = group_mask();
+      auto group      = static_cast<std::size_t>(hash >> 7) & mask;
+
+      for (std::size_t step = 1;; ++step)
+      {
+        auto const base = group * Group::width;
+        Group const g(_ctrl.data() + base);
+        for (auto match = g.match(h2); match != 0; match &= match - 1)
+        {
+          auto const slot = base + std::countr_zero(match);
+          if (Equal{}(_slots[slot], key))
+            return static_cast<Scalar_index>(slot);
+        }
+
+        if (g.match_empty() != 0)
+          return npos;
+
+        group = (group + step) & mask;
+      }
+    }
+
+    /// @brief Check if the key is present.
+    [[nodiscard]] auto contains(Key const& key) const noexcept
+      -> bool { return find(key) != npos; }
+
+    /// @brief Insert a key if it is absent.
+    /// @return true if the key has been inserted, false if it was present already
+    auto insert(Key const& key)
+      -> bool
+    {
+      if (find(key) != npos)
+        return false;
+
+      insert_absent(key);
+      return true;
+    }
+
+    /// @brief Erase a key if it is present.
+    /// @return true if the key has been erased
+    auto erase(Key const& key) noexcept
+      -> bool
+    {
+      auto const slot = find(key);
+      if (slot == npos)
+        return false;
+
+      erase_at(slot);
+      return true;
+    }
+
+    /// @brief Erase the key in a full slot.
+    void erase_at(Scalar_index slot) noexcept
+    {
+      // If the group has an empty slot then no probe sequence has ever gone past this group.
+      auto const base = slot & ~Scalar_index(Group::width - 1);
+      if (Group(_ctrl.data() + base).match_empty() != 0)
+      {
+        _ctrl[slot] = Group::empty;
+        ++_growth_left;
+      }
+      else
+      {
+        _ctrl[slot] = Group::deleted;
+      }
+
+      --_size;
+    }
+
+    /// @brief Remove all the keys keeping the memory.
+    void clear() noexcept
+    {
+      std::fill(_ctrl.begin(), _ctrl.end(), Group::empty);
+      _size        = 0;
+      _growth_left = max_load(capacity());
+    }
+
+    /// @brief Make room for the given count of keys without rehashing.
+    void reserve(Scalar_size count)
+    {
+      if (count - _size > _growth_left)
+        rehash(capacity_for(count));
+    }
+
+  private:
+    std::vector<std::uint8_t> _ctrl;
+    std::vector<Key>          _slots;
+    Scalar_size               _size        = 0;
+    Scalar_size               _growth_left = 0; ///< how many empty slots may be filled before a rehash
+
+    [[nodiscard]] auto group_mask() const noexcept
+      -> std::size_t { return _slots.size() / Group::width - 1; }
+
+    /// Maximal load factor is 7/8.
+    [[nodiscard]] static auto max_load(Scalar_size capacity) noexcept
+      -> Scalar_size { return capacity - capacity / 8; }
+
+    [[nodiscard]] static auto capacity_for(Scalar_size count) noexcept
+      -> Scalar_size
+    {
+      Scalar_size capacity = Group::width;
+      while (max_load(capacity) < count)
+        capacity *= 2;
+      return capacity;
+    }
+
+    void insert_absent(Key const& key)
+    {
+      if (_growth_left == 0)
+      {
+        // Either grow or just purge deleted slots if they take a lot of room.
+        auto const cap = capacity();
+        rehash(_size < cap / 2? max(cap, capacity_for(_size + 1)): capacity_for(2 * cap));
+      }
+
+      auto const hash = Hash{}(key);
+      auto const mask = group_mask();
+      auto group      = static_cast<std::size_t>(hash >> 7) & mask;
+
+      for (std::size_t step = 1;; ++step)
+      {
+        auto const base = group * Group::width;
+        if (auto const free = Group(_ctrl.data() + base).match_free())
+        {
+          auto const slot = base + std::countr_zero(free);
+          if (_ctrl[slot] == Group::empty)
+            --_growth_left;
+
+          _ctrl[slot]  = static_cast<std::uint8_t>(hash & 0x7f);
+          _slots[slot] = key;
+          ++_size;
+          return;
+        }
+
+        group = (group + step) & mask;
+      }
+    }
+
+    void rehash(Scalar_size new_capacity)
+    {
+      auto old_ctrl  = std::move(_ctrl);
+      auto old_slots = std::move(_slots);
+
+      _ctrl.assign(new_capacity, Group::empty);
+      _slots.assign(new_capacity, Key{});
+      _size        = 0;
+      _growth_left = max_load(new_capacity);
+
+      for (std::size_t slot = 0; slot < old_slots.size(); ++slot)
+      {
+        if ((old_ctrl[slot] & Group::empty) == 0)
+          insert_absent(old_slots[slot]);
+      }
+    }
+  };
+
+
+  /// @brief Iterator through the keys of a Flat_hash_set in slot order.
+  template <typename Set, typename Key>
+  class Flat_hash_set_iterator
+    : public Basic_iterator<Key>
+  {
+  public:
+    explicit Flat_hash_set_iterator(Set const& set) noexcept
+      : _set(&set), _slot(set.next_full(0)) {}
+
+    auto next(Key& out_item) noexcept
+      -> bool                override
+    {
+      if (_slot == _set->capacity())
+        return false;
+
+      out_item = _set->at(_slot);
+      _slot    = _set->next_full(_slot + 1);
+      return true;
+    }
+
+    auto next_batch(std::span<Key> out_items) noexcept
+      -> Scalar_size                           override
+    {
+      Scalar_size written = 0;
+      auto const  cap     = _set->capacity();
+      for (auto& out_item: out_items)
+      {
+        if (_slot == cap)
+          break;
+
+        out_item = _set->at(_slot);
+        _slot    = _set->next_full(_slot + 1);
+        ++written;
+      }
+
+      return written;
+    }
+
+  private:
+    Set const*    _set;
+    Scalar_index  _slot;
+  };
+
+}
+
+#endif//OGXX_FLAT_HASH_SET_HPP_INCLUDED
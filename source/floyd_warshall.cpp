@@ -1,37 +1,178 @@
 /// @file floyd_warshall.cpp
-/// @brief Graph view implementation for directed graph represented by an adjacency list.
-/// @author Timashev R.E. 
+/// @brief Floyd-Warshall algorithm for Int_matrix and Float_matrix.
+/// @author Timashev R.E.
 #include <ogxx/floyd_warshall.hpp>
+#include "dense_st_matrix.hpp"
+#include "min_plus.hpp"
+#include <ogxx/thread_pool.hpp>
 namespace ogxx
 {
 
+  namespace
+  {
+
+    /// Tiles of floyd_warshall_tile x floyd_warshall_tile items: three tiles of doubles take 96KiB and stay in L2 cache.
+    constexpr Scalar_size floyd_warshall_tile = 64;
+
+    /// Runs tasks one after another.
+    struct Serial_for
+    {
+      template <typename Task>
+      void operator()(Scalar_size count, Task&& task) const
+      {
+        for (Scalar_index index = 0; index < count; ++index)
+          task(index);
+      }
+    };
+
+    /// Runs tasks on a thread pool.
+    struct Parallel_for
+    {
+      Thread_pool& pool;
+
+      template <typename Task>
+      void operator()(Scalar_size count, Task&& task) const
+      {
+        pool.parallel_for(count, std::forward<Task>(task));
+      }
+    };
+
+    /// @brief Blocked Floyd-Warshall over a row-major n x n array.
+    /// For each diagonal tile: first the tile itself, then the tiles of its row and column, then all the other tiles,
+    /// which depend only on the tiles of the current row and column. Tiles of one phase are independent
+    /// and are given to for_each_tile(count, task(index)) which may run them in parallel.
+    /// Next hops are updated in the same pass unless next is null.
+    template <typename ST, typename For_each_tile>
+    void floyd_warshall_blocked(ST* d, Int* next, Scalar_size n, For_each_tile for_each_tile)
+    {
+      auto const tiles    = (n + floyd_warshall_tile - 1) / floyd_warshall_tile;
+      auto const tile_end = [n](Scalar_index first) { return min(first + floyd_warshall_tile, n); };
+      for (Scalar_index kt = 0; kt < tiles; ++kt)
+      {
+        auto const k0 = kt * floyd_warshall_tile, k1 = tile_end(k0);
+        min_plus_tile(d, next, n, k0, k1, k0, k1, k0, k1);
+
+        // Tiles of the row kt and the column kt except the diagonal one: 2 * (tiles - 1) tasks.
+        for_each_tile(2 * (tiles - 1), [=](Scalar_index task)
+          {
+            auto const t  = task / 2 + (task / 2 >= kt);
+            auto const t0 = t * floyd_warshall_tile, t1 = tile_end(t0);
+            if (task % 2 == 0)
+              min_plus_tile(d, next, n, k0, k1, t0, t1, k0, k1);
+            else
+              min_plus_tile(d, next, n, t0, t1, k0, k1, k0, k1);
+          });
+
+        // All the other tiles: (tiles - 1)^2 tasks.
+        for_each_tile((tiles - 1) * (tiles - 1), [=](Scalar_index task)
+          {
+            auto const it = task / (tiles - 1), jt = task % (tiles - 1);
+            auto const i0 = (it + (it >= kt)) * floyd_warshall_tile;
+            auto const j0 = (jt + (jt >= kt)) * floyd_warshall_tile;
+            min_plus_tile(d, next, n, i0, tile_end(i0), j0, tile_end(j0), k0, k1);
+          });
+      }
+    }
+
+  }
+
  template <typename ST>
-    auto floyd_warshall_only_matrix_ST( const ogxx::St_matrix<ST>& distances)
+    auto floyd_warshall_ST( const ogxx::St_matrix<ST>& distances, Thread_pool* pool, bool with_paths)
     {
-        if(!distances.shape().is_square()) 
-            throw std::invalid_argument("floyd_warshall_only_matrix_ST::ctor: the matrix must be square."); 
+        if(!distances.shape().is_square())
+            throw std::invalid_argument("floyd_warshall_only_matrix_ST::ctor: the matrix must be square.");
         auto n = distances.shape();
-        auto result = distances.copy();
+        Shortest_paths<ST> paths { distances.copy() };
+        auto& result = paths.distances;
+
+        // Initially the next hop is the edge target if there is an edge.
+        Int* next = nullptr;
+        if (with_paths)
+        {
+            paths.next_hops = new_dense_st_matrix<Int>(n);
+            next = static_cast<Dense_st_matrix<Int>&>(*paths.next_hops).data();
+            for (Scalar_index i = 0; i < n.rows; ++i)
+                for (Scalar_index j = 0; j < n.cols; ++j)
+                    next[i * n.cols + j] = i == j || result->get(i, j) != no_path_length<ST>? Int(j): Int(npos);
+        }
+
+        if (auto const dense = dynamic_cast<Dense_st_matrix<ST>*>(result.get()))
+        {
+            if (pool)
+                floyd_warshall_blocked(dense->data(), next, n.rows, Parallel_for{ *pool });
+            else
+                floyd_warshall_blocked(dense->data(), next, n.rows, Serial_for{});
+            return paths;
+        }
 
+        // Generic fallback through the St_matrix interface (serial).
             for (Scalar_index k = 0; k < n.cols; ++k)
                 {
                     for (Scalar_index i = 0; i < n.rows; ++i)
                     {
+                        auto const through = result->get(i,k);
                         for (Scalar_index l = 0; l < n.cols; ++l)
                         {
-                        auto member = min(result->get(i,l), result->get(i,k) + result->get(k,l));
-                        result->set(i,l,member);
+                        auto const member = saturating_add(through, result->get(k,l));
+                        if (member < result->get(i,l))
+                        {
+                            result->set(i,l,member);
+                            if (next)
+                                next[i * n.cols + l] = next[i * n.cols + k];
+                        }
                         }
                     }
                 }
-        return result;
+        return paths;
     }
     auto floyd_warshall_only_matrix(Int_matrix const& distances) -> Int_matrix_uptr{
-        return floyd_warshall_only_matrix_ST(distances); 
+        return floyd_warshall_ST(distances, nullptr, false).distances;
     }
 
     auto floyd_warshall_only_matrix(Float_matrix const& distances) -> Float_matrix_uptr{
-        return floyd_warshall_only_matrix_ST(distances); 
+        return floyd_warshall_ST(distances, nullptr, false).distances;
+    }
+
+    auto floyd_warshall_only_matrix(Int_matrix const& distances, Thread_pool& pool) -> Int_matrix_uptr{
+        return floyd_warshall_ST(distances, &pool, false).distances;
+    }
+
+    auto floyd_warshall_only_matrix(Float_matrix const& distances, Thread_pool& pool) -> Float_matrix_uptr{
+        return floyd_warshall_ST(distances, &pool, false).distances;
+    }
+
+    auto floyd_warshall(Int_matrix const& distances) -> Shortest_paths<Int>{
+        return floyd_warshall_ST(distances, nullptr, true);
+    }
+
+    auto floyd_warshall(Float_matrix const& distances) -> Shortest_paths<Float>{
+        return floyd_warshall_ST(distances, nullptr, true);
+    }
+
+    auto floyd_warshall(Int_matrix const& distances, Thread_pool& pool) -> Shortest_paths<Int>{
+        return floyd_warshall_ST(distances, &pool, true);
+    }
+
+    auto floyd_warshall(Float_matrix const& distances, Thread_pool& pool) -> Shortest_paths<Float>{
+        return floyd_warshall_ST(distances, &pool, true);
+    }
+
+
+    Path_iterator::Path_iterator(Int_matrix const& next_hops, Vertex_index from, Vertex_index to) noexcept
+        : _next_hops(&next_hops), _current(from), _to(to), _hops_left(next_hops.shape().rows)
+    {
+        if (!next_hops.shape().contains({ from, to }) || next_hops.get(from, to) == npos)
+            _current = npos;
+    }
+
+    auto Path_iterator::next(Vertex_index& vertex) noexcept -> bool
+    {
+        if (_current == npos || _hops_left-- == 0)
+            return false;
+
+        vertex = _current;
+        _current = _current == _to? npos: Vertex_index(_next_hops->get(_current, _to));
+        return true;
     }
 
 }
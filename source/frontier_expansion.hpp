@@ -0,0 +1,76 @@
+/// @file source/frontier_expansion.hpp
+/// @brief Level-synchronous parallel frontier expansion shared by parallel traversals.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_FRONTIER_EXPANSION_HPP_INCLUDED
+#define OGXX_FRONTIER_EXPANSION_HPP_INCLUDED
+
+#include <ogxx/thread_pool.hpp>
+#include <ogxx/vertex_pair.hpp>
+
+#include <algorithm>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief Frontier vertices expanded by one task.
+  constexpr Scalar_size frontier_chunk = 512;
+
+  /// @brief Expand the frontier level by level until it becomes empty.
+  /// The frontier is split into chunks expanded in parallel, expand(u, emit) calls emit(v) for each vertex v
+  /// it claims from u (claiming must be thread-safe, e.g. by Atomic_bitvector::set).
+  /// Each chunk collects the emitted vertices in a buffer of its own, the buffers are concatenated into the next frontier.
+  /// on_level(frontier) is called with the frontier of each level before expanding it.
+  template <typename Expand, typename On_level>
+  void expand_frontier(std::vector<Vertex_index> frontier, Thread_pool& pool, Expand&& expand, On_level&& on_level)
+  {
+    std::vector<Vertex_index>               next;
+    std::vector<std::vector<Vertex_index>>  discovered;
+    std::vector<Scalar_index>               placement;
+
+    while (!frontier.empty())
+    {
+      on_level(std::span<Vertex_index const>(frontier));
+      auto const size  = static_cast<Scalar_size>(frontier.size());
+      auto const tasks = (size + frontier_chunk - 1) / frontier_chunk;
+      if (static_cast<Scalar_size>(discovered.size()) < tasks)
+        discovered.resize(tasks);
+
+      pool.parallel_for(tasks, [&](Scalar_index task)
+        {
+          auto& buffer = discovered[task];
+          buffer.clear();
+
+          auto const emit = [&buffer](Vertex_index v) { buffer.push_back(v); };
+          auto const last = min(size, (task + 1) * frontier_chunk);
+          for (auto i = task * frontier_chunk; i < last; ++i)
+            expand(frontier[i], emit);
+        });
+
+      placement.assign(tasks + 1, 0);
+      for (Scalar_index task = 0; task < tasks; ++task)
+        placement[task + 1] = placement[task] + static_cast<Scalar_size>(discovered[task].size());
+
+      next.resize(placement[tasks]);
+      pool.parallel_for(tasks, [&](Scalar_index task)
+        {
+          std::copy(discovered[task].begin(), discovered[task].end(), next.begin() + placement[task]);
+        });
+
+      frontier.swap(next);
+    }
+  }
+
+  /// @brief Expand the frontier level by level until it becomes empty, see the version with on_level.
+  template <typename Expand>
+  void expand_frontier(std::vector<Vertex_index> frontier, Thread_pool& pool, Expand&& expand)
+  {
+    expand_frontier(std::move(frontier), pool, std::forward<Expand>(expand), [](std::span<Vertex_index const>) {});
+  }
+
+}
+
+#endif//OGXX_FRONTIER_EXPANSION_HPP_INCLUDED
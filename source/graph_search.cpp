@@ -0,0 +1,162 @@
+/// @file graph_search.cpp
+/// @brief Generic graph search implementation.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/graph_search.hpp>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Used when no controller is given: goes on until exhaustion.
+    Graph_search_controller passive_controller;
+
+    auto controller_or_passive(Graph_search_controller_uptr const& controller) noexcept
+      -> Graph_search_controller&
+    {
+      return controller? *controller: passive_controller;
+    }
+
+    template <Search_order order>
+    auto search_without_visited(Vertex_index start_index, Graph_view const& graph, Graph_search_controller_uptr const& controller)
+      -> bool
+    {
+      return graph_search<order>(start_index, graph, controller_or_passive(controller));
+    }
+
+  }
+
+
+  auto graph_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Index_set_uptr visited_vertices,
+    Index_bag_uptr vertex_order,
+    Graph_search_controller_uptr controller
+  ) -> bool
+  {
+    if (!visited_vertices || !vertex_order)
+      throw std::invalid_argument("graph_search: visited_vertices and vertex_order are required.");
+
+    auto& events = controller_or_passive(controller);
+    if (!visited_vertices->insert(start_index))
+      return false;
+    if (!events.discover_vertex(start_index, npos))
+      return true;
+
+    vertex_order->put(start_index);
+
+    bool is_stopped = false;
+    while (!vertex_order->is_empty())
+    {
+      auto const u = vertex_order->take();
+      auto neighbors = graph.iterate_neighbors(u);
+      for_each_batch(*neighbors, [&](std::span<Vertex_index> batch)
+        {
+          for (auto v: batch)
+          {
+            if (!events.examine_edge(u, v))
+              return !(is_stopped = true);
+
+            if (visited_vertices->insert(v))
+            {
+              if (!events.discover_vertex(v, u))
+                return !(is_stopped = true);
+              vertex_order->put(v);
+            }
+          }
+
+          return true;
+        });
+
+      if (is_stopped || !events.finish_vertex(u))
+        return true;
+    }
+
+    return false;
+  }
+
+  auto graph_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Index_bag_uptr vertex_order,
+    Graph_search_controller_uptr controller
+  ) -> bool
+  {
+    return graph_search(start_index, graph, new_index_set_bitvector(), std::move(vertex_order), std::move(controller));
+  }
+
+
+  auto depth_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Index_set_uptr visited_vertices,
+    Graph_search_controller_uptr controller
+  ) -> bool
+  {
+    return graph_search(start_index, graph, std::move(visited_vertices), new_index_stack(), std::move(controller));
+  }
+
+  auto depth_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Graph_search_controller_uptr controller
+  ) -> bool
+  {
+    return search_without_visited<Search_order::depth_first>(start_index, graph, controller);
+  }
+
+
+  auto breadth_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Index_set_uptr visited_vertices,
+    Graph_search_controller_uptr controller
+  ) -> bool
+  {
+    return graph_search(start_index, graph, std::move(visited_vertices), new_index_queue(), std::move(controller));
+  }
+
+  auto breadth_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Graph_search_controller_uptr controller
+  ) -> bool
+  {
+    return search_without_visited<Search_order::breadth_first>(start_index, graph, controller);
+  }
+
+
+  auto breadth_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Graph_search_controller_uptr controller,
+    Bfs_mode mode
+  ) -> bool
+  {
+    return breadth_first_search(start_index, graph, controller_or_passive(controller), mode);
+  }
+
+
+  auto random_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Index_set_uptr visited_vertices,
+    Graph_search_controller_uptr controller
+  ) -> bool
+  {
+    return graph_search(start_index, graph, std::move(visited_vertices), new_index_random_choice_bag(), std::move(controller));
+  }
+
+  auto random_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Graph_search_controller_uptr controller
+  ) -> bool
+  {
+    return search_without_visited<Search_order::random_first>(start_index, graph, controller);
+  }
+
+}
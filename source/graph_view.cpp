@@ -0,0 +1,98 @@
+/// @file graph_view.cpp
+/// @brief Default implementations of Graph_view virtual functions.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/graph_view.hpp>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Filters the edges of a directed graph picking the tails of the edges coming into the vertex.
+    class In_neighbor_iterator
+      : public Index_iterator
+    {
+    public:
+      In_neighbor_iterator(Vertex_index to, Vertex_pair_iterator_uptr edges) noexcept
+        : _to(to), _edges(std::move(edges)) {}
+
+      auto next(Vertex_index& value) noexcept
+        -> bool                         override
+      {
+        for (Vertex_pair edge; _edges && _edges->next(edge);)
+        {
+          if (edge.second == _to)
+          {
+            value = edge.first;
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      auto next_batch(std::span<Vertex_index> values) noexcept
+        -> Scalar_size                                override
+      {
+        Scalar_size written = 0;
+        auto const  count   = static_cast<Scalar_size>(values.size());
+
+        // Each edge yields at most one in-neighbor, so never pull more edges than there are free slots left.
+        Vertex_pair edges[iterator_batch_size];
+        while (_edges && written < count)
+        {
+          auto const wanted = min(count - written, iterator_batch_size);
+          auto const got    = _edges->next_batch(std::span(edges, wanted));
+          for (Scalar_size i = 0; i < got; ++i)
+          {
+            if (edges[i].second == _to)
+              values[written++] = edges[i].first;
+          }
+
+          if (got < wanted)
+            break;
+        }
+
+        return written;
+      }
+
+    private:
+      Vertex_index              _to;
+      Vertex_pair_iterator_uptr _edges;
+    };
+
+  }
+
+
+  auto Graph_view::iterate_in_neighbors(Vertex_index to) const
+    -> Index_iterator_handle
+  {
+    if (!is_directed())
+      return iterate_neighbors(to);
+
+    return make_iterator_handle<In_neighbor_iterator>(to, iterate_edges());
+  }
+
+
+  auto Graph_view::in_degree(Vertex_index to) const
+    -> Scalar_size
+  {
+    if (to < 0 || vertex_count() <= to)
+      return 0;
+
+    Scalar_size result = 0;
+    auto in_neighbors = iterate_in_neighbors(to);
+
+    Vertex_index batch[iterator_batch_size];
+    for (;;)
+    {
+      auto const got = in_neighbors->next_batch(batch);
+      result += got;
+      if (got < iterator_batch_size)
+        return result;
+    }
+  }
+
+}
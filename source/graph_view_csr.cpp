@@ -0,0 +1,215 @@
+/// @file graph_view_csr.cpp
+/// @brief Graph view implementation for directed and undirected graphs represented by a CSR adjacency list.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include "adjacency_list_csr.hpp"
+#include <ogxx/weighted_graph_view.hpp>
+#include <ogxx/stl_iterator.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Walks the arrays producing (from, to) pairs, only pairs with from <= to if upper_only.
+    template <bool upper_only>
+    class Csr_edge_iterator
+      : public Basic_iterator<Vertex_pair>
+    {
+    public:
+      explicit Csr_edge_iterator(Csr_view csr) noexcept
+        : _csr(csr) {}
+
+      auto next(Vertex_pair& out_item) noexcept
+        -> bool                        override
+      {
+        return next_batch(std::span(&out_item, 1)) == 1;
+      }
+
+      auto next_batch(std::span<Vertex_pair> out_items) noexcept
+        -> Scalar_size                                   override
+      {
+        Scalar_size written   = 0;
+        auto const  count     = static_cast<Scalar_size>(out_items.size());
+        auto const  vertices  = _csr.vertex_count();
+        auto const  targets   = _csr.targets.data();
+
+        for (; written < count && _from < vertices; ++_from)
+        {
+          auto const row_end = _csr.offsets[_from + 1];
+          if (_cur < _csr.offsets[_from])
+            _cur = _csr.offsets[_from];
+
+          for (; written < count && _cur < row_end; ++_cur)
+          {
+            if (!upper_only || _from <= targets[_cur])
+              out_items[written++] = Vertex_pair{ _from, targets[_cur] };
+          }
+
+          if (_cur < row_end)
+            break;
+        }
+
+        return written;
+      }
+
+    private:
+      Csr_view      _csr;
+      Vertex_index  _from = 0;
+      Scalar_index  _cur  = 0;
+    };
+
+
+    template <bool is_directed_graph>
+    class Graph_view_csr final
+      : public Graph_view
+    {
+    public:
+      explicit Graph_view_csr(Adjacency_list_csr const& al) noexcept
+        : _csr(al.csr())
+        , _csc(is_directed_graph? al.csc(): al.csr())
+        , _edge_count(is_directed_graph
+            ? al.degrees_sum()
+            : (al.degrees_sum() + al.loop_count()) / 2) {}
+
+      [[nodiscard]] auto csr() const noexcept
+        -> Csr_view { return _csr; }
+
+      [[nodiscard]] auto csc() const noexcept
+        -> Csr_view { return _csc; }
+
+
+      // Constant interface
+
+      [[nodiscard]] auto is_directed() const noexcept
+        -> bool                         override
+      {
+        return is_directed_graph;
+      }
+
+      [[nodiscard]] auto vertex_count() const noexcept
+        -> Scalar_size                  override
+      {
+        return _csr.vertex_count();
+      }
+
+      [[nodiscard]] auto edge_count() const noexcept
+        -> Scalar_size                override
+      {
+        return _edge_count;
+      }
+
+      [[nodiscard]] auto iterate_edges() const
+        -> Vertex_pair_iterator_uptr     override
+      {
+        return std::make_unique<Csr_edge_iterator<!is_directed_graph>>(_csr);
+      }
+
+      [[nodiscard]] auto iterate_neighbors(Vertex_index from) const
+        -> Index_iterator_handle                              override
+      {
+        auto const neighbors = is_vertex(from)? _csr.neighbors(from): std::span<Vertex_index const>{};
+        return make_stl_iterator_handle(neighbors.data(), neighbors.data() + neighbors.size());
+      }
+
+      [[nodiscard]] auto iterate_in_neighbors(Vertex_index to) const
+        -> Index_iterator_handle                               override
+      {
+        if (!_csc)
+          return Graph_view::iterate_in_neighbors(to);
+
+        auto const in_neighbors = is_vertex(to)? _csc.neighbors(to): std::span<Vertex_index const>{};
+        return make_stl_iterator_handle(in_neighbors.data(), in_neighbors.data() + in_neighbors.size());
+      }
+
+      [[nodiscard]] auto in_degree(Vertex_index to) const
+        -> Scalar_size                               override
+      {
+        if (!_csc)
+          return Graph_view::in_degree(to);
+
+        return is_vertex(to)? _csc.degree(to): 0;
+      }
+
+      [[nodiscard]] auto are_connected(Vertex_pair edge) const noexcept
+        -> bool                                          override
+      {
+        auto const [from, to] = edge;
+        if (!is_vertex(from))
+          return false;
+
+        auto const neighbors = _csr.neighbors(from);
+        return std::binary_search(neighbors.begin(), neighbors.end(), to);
+      }
+
+
+      // Non-constant interface
+
+      void set_vertex_count(Scalar_size) override
+      {
+        throw std::logic_error("Graph_view::set_vertex_count: CSR adjacency list is read-only.");
+      }
+
+      auto connect(Vertex_pair)
+        -> bool override
+      {
+        throw std::logic_error("Graph_view::connect: CSR adjacency list is read-only.");
+      }
+
+      auto disconnect(Vertex_pair)
+        -> bool override
+      {
+        throw std::logic_error("Graph_view::disconnect: CSR adjacency list is read-only.");
+      }
+
+    private:
+      Csr_view    _csr;
+      Csr_view    _csc; ///< in-adjacencies: the same as _csr for an undirected graph, may be empty for a directed graph
+      Scalar_size _edge_count;
+
+      [[nodiscard]] auto is_vertex(Vertex_index vertex) const noexcept
+        -> bool
+      {
+        return 0 <= vertex && vertex < _csr.vertex_count();
+      }
+    };
+
+  }
+
+
+  auto new_graph_view_csr(Adjacency_list_csr const& al, bool is_directed)
+    -> Graph_view_uptr
+  {
+    if (is_directed)
+      return std::make_unique<Graph_view_csr<true>>(al);
+    return std::make_unique<Graph_view_csr<false>>(al);
+  }
+
+
+  auto csr_view(Graph_view const& gv) noexcept
+    -> Csr_view
+  {
+    if (auto const view = dynamic_cast<Graph_view_csr<true> const*>(&gv))
+      return view->csr();
+    if (auto const view = dynamic_cast<Graph_view_csr<false> const*>(&gv))
+      return view->csr();
+    if (auto const view = dynamic_cast<Int_weighted_graph_view const*>(&gv))
+      return view->weighted_csr();
+    if (auto const view = dynamic_cast<Float_weighted_graph_view const*>(&gv))
+      return view->weighted_csr();
+    return {};
+  }
+
+  auto csc_view(Graph_view const& gv) noexcept
+    -> Csr_view
+  {
+    if (auto const view = dynamic_cast<Graph_view_csr<true> const*>(&gv))
+      return view->csc();
+    return {};
+  }
+
+}
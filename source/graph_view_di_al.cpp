@@ -1,8 +1,8 @@
 /// @file graph_view_di_al.cpp
 /// @brief Graph view implementation for directed graph represented by an adjacency list.
 /// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include "adjacency_list_csr.hpp"
 #include <ogxx/graph_view.hpp>
-#include <ogxx/adjacency_list.hpp>
 #include <ogxx/stl_iterator.hpp>
 
 namespace ogxx
@@ -19,10 +19,7 @@ namespace ogxx
         : _al(al), _al_size(_al.size()), _cur_from(0)
       {
         if (_cur_from < _al_size)
-        {
-          if (auto const adj_ptr = _al.get(_cur_from).adjacency)
-            _adj = adj_ptr->iterate();
-        }
+          open_adjacency();
       }
 
 
@@ -34,7 +31,7 @@ namespace ogxx
 
         for (;;)
         {
-          if (Vertex_index to; _adj->next(to))
+          if (Vertex_index to; _adj && _adj->next(to))
           {
             out_item = Vertex_pair{ _cur_from, to };
             return true;
@@ -43,16 +40,52 @@ namespace ogxx
           if (++_cur_from == _al_size)
             return false;
           
-          if (auto const adj_ptr = _al.get(_cur_from).adjacency)
-            _adj = adj_ptr->iterate();
+          open_adjacency();
         }
       }
 
+      auto next_batch(std::span<Vertex_pair> out_items) noexcept
+        -> Scalar_size                                   override
+      {
+        Scalar_size written = 0;
+        auto const  count   = static_cast<Scalar_size>(out_items.size());
+
+        Vertex_index to[iterator_batch_size];
+        while (written < count && _cur_from < _al_size)
+        {
+          if (_adj)
+          {
+            auto const wanted = min(count - written, iterator_batch_size);
+            auto const got    = _adj->next_batch(std::span(to, wanted));
+            for (Scalar_size i = 0; i < got; ++i)
+              out_items[written++] = Vertex_pair{ _cur_from, to[i] };
+
+            if (got == wanted)
+              continue;
+          }
+
+          if (++_cur_from == _al_size)
+            break;
+
+          open_adjacency();
+        }
+
+        return written;
+      }
+
     private:
       Adjacency_list const&             _al;
       Scalar_size                       _al_size;
       Scalar_index                      _cur_from;
-      Basic_iterator_uptr<Scalar_index> _adj;
+      Index_iterator_handle             _adj;
+
+      void open_adjacency()
+      {
+        if (auto const adj_ptr = _al.get(_cur_from).adjacency)
+          _adj = adj_ptr->iterate_handle();
+        else
+          _adj.reset();
+      }
     };
 
 
@@ -97,13 +130,13 @@ namespace ogxx
       }
 
       [[nodiscard]] auto iterate_neighbors(Vertex_index from) const
-        -> Index_iterator_uptr                                override
+        -> Index_iterator_handle                              override
       {
         if (auto const adj_ptr = _al.get(from).adjacency)
-          return adj_ptr->iterate();
+          return adj_ptr->iterate_handle();
 
-        static Scalar_index const dummy;
-        return new_stl_iterator(&dummy, &dummy);
+        static Scalar_index const dummy = npos;
+        return make_stl_iterator_handle(&dummy, &dummy);
       }
 
       [[nodiscard]] auto are_connected(Vertex_pair edge) const noexcept
@@ -143,21 +176,7 @@ namespace ogxx
         else
         {
           auto const [from, to] = edge;
-
-          auto adj_ptr = _al.get(from).adjacency;
-          Adjacency_uptr adj_storage;
-          if (!adj_ptr)
-          {
-            adj_storage = new_adjacency_sortedvector();
-            adj_ptr     = adj_storage.get();
-          }
-
-          auto const result = adj_ptr->insert(to);
-
-          if (adj_storage)
-            _al.set(from, { from, adj_storage.release() });
-
-          return result;
+          return _al.get_or_create_adjacency(from).insert(to);
         }
       }
 
@@ -189,12 +208,16 @@ namespace ogxx
     auto graph_view(Adjacency_list const& al)
       -> Graph_view_const_uptr
     {
+      if (auto const csr = dynamic_cast<Adjacency_list_csr const*>(&al))
+        return new_graph_view_csr(*csr, true);
       return std::make_unique<Graph_view_directed_adjacency_list<true>>(al);
     }
 
     auto graph_view(Adjacency_list& al)
       -> Graph_view_uptr
     {
+      if (auto const csr = dynamic_cast<Adjacency_list_csr const*>(&al))
+        return new_graph_view_csr(*csr, true);
       return std::make_unique<Graph_view_directed_adjacency_list<false>>(al);
     }
   }
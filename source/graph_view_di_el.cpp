@@ -16,10 +16,13 @@ namespace ogxx
     : public Index_iterator
   {
   public:
+    /// The edge iterator handle is kept small for this iterator to fit into an Index_iterator_handle.
+    using Edge_iterator_handle = Basic_iterator_handle<Vertex_pair, 32>;
+
     Edge_list_neighbor_iterator() noexcept = default;
     Edge_list_neighbor_iterator(
-        Vertex_index              from,
-        Vertex_pair_iterator_uptr edges)
+        Vertex_index         from,
+        Edge_iterator_handle edges)
       : _from(from)
       , _edge_iter(std::move(edges)) {}
 
@@ -37,9 +40,34 @@ namespace ogxx
       return false;
     }
 
+    auto next_batch(std::span<Vertex_index> values)
+      -> Scalar_size override
+    {
+      Scalar_size written = 0;
+      auto const  count   = static_cast<Scalar_size>(values.size());
+
+      // Each edge yields at most one neighbor, so never pull more edges than there are free slots left.
+      Vertex_pair edges[iterator_batch_size];
+      while (written < count)
+      {
+        auto const wanted = min(count - written, iterator_batch_size);
+        auto const got    = _edge_iter->next_batch(std::span(edges, wanted));
+        for (Scalar_size i = 0; i < got; ++i)
+        {
+          if (edges[i].first == _from)
+            values[written++] = edges[i].second;
+        }
+
+        if (got < wanted)
+          break;
+      }
+
+      return written;
+    }
+
   private:
     Vertex_index              _from = 0;
-    Vertex_pair_iterator_uptr _edge_iter;
+    Edge_iterator_handle      _edge_iter;
   };
 
 
@@ -77,9 +105,9 @@ namespace ogxx
     }
 
     [[nodiscard]] auto iterate_neighbors(Vertex_index from) const
-      -> Index_iterator_uptr                                override
+      -> Index_iterator_handle                              override
     {
-      return std::make_unique<Edge_list_neighbor_iterator>(from, _el.iterate());
+      return make_iterator_handle<Edge_list_neighbor_iterator>(from, _el.iterate_handle());
     }
 
     [[nodiscard]] auto are_connected(Vertex_pair edge) const noexcept
@@ -0,0 +1,217 @@
+/// @file graph_view_un_al.cpp
+/// @brief Graph view implementation for undirected graph represented by an adjacency list storing each edge in both directions.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include "adjacency_list_csr.hpp"
+#include <ogxx/stl_iterator.hpp>
+
+#include <stdexcept>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Produces (from, to) pairs with from <= to, so each edge is met once.
+    class Vertex_pair_iterator_un_al
+      : public Basic_iterator<Vertex_pair>
+    {
+    public:
+      explicit Vertex_pair_iterator_un_al(Adjacency_list const& al)
+        : _entries(al.iterate()) {}
+
+      auto next(Vertex_pair& out_item) noexcept
+        -> bool                        override
+      {
+        for (;;)
+        {
+          for (Vertex_index to; _adj && _adj->next(to);)
+          {
+            if (_from <= to)
+            {
+              out_item = Vertex_pair{ _from, to };
+              return true;
+            }
+          }
+
+          Adjacency_list_entry entry;
+          if (!_entries->next(entry))
+            return false;
+
+          _from = entry.vertex;
+          if (entry.adjacency)
+            _adj = entry.adjacency->iterate_handle();
+          else
+            _adj.reset();
+        }
+      }
+
+    private:
+      Basic_iterator_uptr<Adjacency_list_entry> _entries;
+      Vertex_index                              _from = npos;
+      Index_iterator_handle                     _adj;
+    };
+
+
+    template <bool is_constant>
+    class Graph_view_undirected_adjacency_list
+      : public Graph_view
+    {
+    public:
+      using Adjacency_list_ref =
+        std::conditional_t<is_constant,
+                           Adjacency_list const&,
+                           Adjacency_list&>;
+
+      explicit Graph_view_undirected_adjacency_list(Adjacency_list_ref al)
+        : _al(al) {}
+
+
+      // Constant interface
+
+      [[nodiscard]] auto is_directed() const noexcept
+        -> bool                         override
+      {
+        return false;
+      }
+
+      [[nodiscard]] auto vertex_count() const noexcept
+        -> Scalar_size                  override
+      {
+        return _al.get_vertex_count();
+      }
+
+      [[nodiscard]] auto edge_count() const noexcept
+        -> Scalar_size                override
+      {
+        // A loop is stored once, any other edge is stored twice.
+        Scalar_size loops = 0;
+        auto entries = _al.iterate();
+        for (Adjacency_list_entry entry; entries->next(entry);)
+        {
+          if (entry.adjacency && entry.adjacency->contains(entry.vertex))
+            ++loops;
+        }
+
+        return (_al.degrees_sum() + loops) / 2;
+      }
+
+      [[nodiscard]] auto iterate_edges() const
+        -> Vertex_pair_iterator_uptr     override
+      {
+        return std::make_unique<Vertex_pair_iterator_un_al>(_al);
+      }
+
+      [[nodiscard]] auto iterate_neighbors(Vertex_index from) const
+        -> Index_iterator_handle                              override
+      {
+        if (auto const adj_ptr = _al.get(from).adjacency)
+          return adj_ptr->iterate_handle();
+
+        static Scalar_index const dummy = npos;
+        return make_stl_iterator_handle(&dummy, &dummy);
+      }
+
+      [[nodiscard]] auto are_connected(Vertex_pair edge) const noexcept
+        -> bool                                          override
+      {
+        auto const [from, to] = edge;
+        if (max(from, to) >= _al.size())
+          return false;
+
+        if (auto const adj_ptr = _al.get(from).adjacency)
+          return adj_ptr->contains(to);
+        return false;
+      }
+
+
+      // Non-constant interface
+
+      void set_vertex_count(Scalar_size count) override
+      {
+        if constexpr (is_constant)
+        {
+          throw std::logic_error("Graph_view::set_vertex_count: constness violation.");
+        }
+        else
+        {
+          _al.set_vertex_count(count);
+        }
+      }
+
+      auto connect(Vertex_pair edge)
+        -> bool override
+      {
+        if constexpr (is_constant)
+        {
+          throw std::logic_error("Graph_view::connect: constness violation.");
+        }
+        else
+        {
+          auto const [a, b] = edge;
+          auto const result = insert_arrow(a, b);
+          if (a != b)
+            insert_arrow(b, a);
+          return result;
+        }
+      }
+
+      auto disconnect(Vertex_pair edge)
+        -> bool override
+      {
+        if constexpr (is_constant)
+        {
+          throw std::logic_error("Graph_view::disconnect: constness violation.");
+        }
+        else
+        {
+          auto const [a, b] = edge;
+          auto const result = erase_arrow(a, b);
+          if (a != b)
+            erase_arrow(b, a);
+          return result;
+        }
+      }
+
+    private:
+      Adjacency_list_ref _al;
+
+      auto insert_arrow(Vertex_index from, Vertex_index to)
+        -> bool
+      {
+        return _al.get_or_create_adjacency(from).insert(to);
+      }
+
+      auto erase_arrow(Vertex_index from, Vertex_index to)
+        -> bool
+      {
+        if (auto const adj_ptr = _al.get(from).adjacency)
+          return adj_ptr->erase(to);
+        return false;
+      }
+    };
+
+  }
+
+
+  namespace undirected
+  {
+    auto graph_view(Adjacency_list const& al)
+      -> Graph_view_const_uptr
+    {
+      if (auto const csr = dynamic_cast<Adjacency_list_csr const*>(&al))
+        return new_graph_view_csr(*csr, false);
+      return std::make_unique<Graph_view_undirected_adjacency_list<true>>(al);
+    }
+
+    auto graph_view(Adjacency_list& al)
+      -> Graph_view_uptr
+    {
+      if (auto const csr = dynamic_cast<Adjacency_list_csr const*>(&al))
+        return new_graph_view_csr(*csr, false);
+      return std::make_unique<Graph_view_undirected_adjacency_list<false>>(al);
+    }
+  }
+
+}
@@ -50,17 +50,16 @@ namespace ogxx
         : public Index_iterator
       {
       public:
-        Row_ones_indices_iterator() noexcept = default;
-        explicit Row_ones_indices_iterator(Basic_iterator_uptr<bool> items)
-          : _item_iter(std::move(items)) {}
+        Row_ones_indices_iterator(Bit_matrix const& bit, Scalar_index row) noexcept
+          : bit_m(&bit), _row(row), _cols(bit.shape().cols) {}
 
         bool next(Scalar_index& value) override
         {
-          for (bool item; _item_iter->next(item); ++_cur)
+          for (; _cur < _cols; ++_cur)
           {
-            if (item) 
+            if (bit_m->get(_row, _cur)) 
             {
-              value = _cur;
+              value = _cur++;
               return true;
             }
           }
@@ -68,9 +67,25 @@ namespace ogxx
           return false;
         }
 
+        auto next_batch(std::span<Scalar_index> values)
+          -> Scalar_size override
+        {
+          Scalar_size written = 0;
+          auto const  count   = static_cast<Scalar_size>(values.size());
+          for (; written < count && _cur < _cols; ++_cur)
+          {
+            if (bit_m->get(_row, _cur))
+              values[written++] = _cur;
+          }
+
+          return written;
+        }
+
       private:
-          Scalar_index              _cur = 0;
-          Basic_iterator_uptr<bool> _item_iter;
+          Bit_matrix const* bit_m = nullptr;
+          Scalar_index      _row  = 0;
+          Scalar_index      _cols = 0;
+          Scalar_index      _cur  = 0;
       };
 
     }
@@ -114,9 +129,10 @@ namespace ogxx
         }
 
         [[nodiscard]] auto iterate_neighbors(Vertex_index from) const
-          -> Index_iterator_uptr                                override
+          -> Index_iterator_handle                              override
         {
-            return std::make_unique<Row_ones_indices_iterator>(bit_m.iterate_row(from));
+            // Reading the row bit by bit needs no row iterator object to be allocated.
+            return make_iterator_handle<Row_ones_indices_iterator>(bit_m, from);
         }
 
         [[nodiscard]] auto are_connected(Vertex_pair edge) const noexcept
@@ -0,0 +1,407 @@
+/// @file index_set_algebra.cpp
+/// @brief Bulk set algebra over Index_set objects with specialized loops for the library implementations.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include "index_set_sortedvector.hpp"
+#include "index_set_bitvector.hpp"
+#include "index_set_hashtable.hpp"
+#include "adjacency_list_csr.hpp"
+#include <ogxx/iterator_algorithms.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    using Sorted_items = std::span<Scalar_index const>;
+    using Word         = Index_set_bitvector::Word;
+
+    /// If one sorted range is this many times longer than the other, galloping beats merging.
+    constexpr Scalar_size gallop_ratio = 32;
+
+
+    /// What we know about the implementation of a set.
+    struct Set_view
+    {
+      Index_set const*                      set      = nullptr;
+      bool                                  is_sorted = false;
+      Sorted_items                          sorted;
+      Index_set_bitvector const*            bits     = nullptr;
+      Index_set_hashtable const*            hash     = nullptr;
+      Sized_iterable<Scalar_index> const*   iterable = nullptr;
+
+      /// Estimated cost of iterating the set.
+      [[nodiscard]] auto iteration_cost() const noexcept
+        -> Scalar_size
+      {
+        if (is_sorted)
+          return static_cast<Scalar_size>(sorted.size());
+        if (bits)
+          return static_cast<Scalar_size>(bits->words().size()) * Index_set_bitvector::word_bits;
+        if (iterable)
+          return iterable->size();
+        return std::numeric_limits<Scalar_size>::max();
+      }
+    };
+
+    [[nodiscard]] auto view(Index_set const& set)
+      -> Set_view
+    {
+      Set_view result;
+      result.set      = &set;
+      result.iterable = dynamic_cast<Sized_iterable<Scalar_index> const*>(&set);
+
+      if (auto const sv = dynamic_cast<Index_set_sortedvector const*>(&set))
+      {
+        result.is_sorted = true;
+        result.sorted    = sv->items();
+      }
+      else if (auto const csr = dynamic_cast<Csr_adjacency const*>(&set))
+      {
+        result.is_sorted = true;
+        result.sorted    = csr->items();
+      }
+      else
+      {
+        result.bits = dynamic_cast<Index_set_bitvector const*>(&set);
+        result.hash = dynamic_cast<Index_set_hashtable const*>(&set);
+      }
+
+      return result;
+    }
+
+
+    /// Call f(item) for each item of the set.
+    template <typename F>
+    void for_each_item(Set_view const& s, F&& f)
+    {
+      if (s.is_sorted)
+      {
+        for (auto item: s.sorted)
+          f(item);
+      }
+      else if (s.bits)
+      {
+        Scalar_index base = 0;
+        for (auto word: s.bits->words())
+        {
+          for (; word != 0; word &= word - 1)
+            f(base + std::countr_zero(word));
+          base += Index_set_bitvector::word_bits;
+        }
+      }
+      else if (s.iterable)
+      {
+        auto items = s.iterable->iterate_handle();
+        for_each_batch(*items, [&](std::span<Scalar_index> batch)
+          {
+            for (auto item: batch)
+              f(item);
+            return true;
+          });
+      }
+      else
+      {
+        throw std::invalid_argument("Index_set algebra: the set is not iterable.");
+      }
+    }
+
+    /// Call f(contains) where contains(item) is a membership test without a virtual call if possible.
+    template <typename F>
+    decltype(auto) with_probe(Set_view const& s, F&& f)
+    {
+      if (s.is_sorted)
+        return f([sorted = s.sorted](Scalar_index item) { return std::binary_search(sorted.begin(), sorted.end(), item); });
+      if (s.bits)
+        return f([bits = s.bits](Scalar_index item) { return bits->Index_set_bitvector::contains(item); });
+      if (s.hash)
+        return f([hash = s.hash](Scalar_index item) { return hash->Index_set_hashtable::contains(item); });
+      return f([set = s.set](Scalar_index item) { return set->contains(item); });
+    }
+
+    /// Call out(item) for each item of both the sets: merging or galloping.
+    template <typename Out>
+    void intersect_sorted(Sorted_items a, Sorted_items b, Out&& out)
+    {
+      if (a.size() > b.size())
+        std::swap(a, b);
+
+      auto const na = a.size(), nb = b.size();
+      if (static_cast<Scalar_size>(na) * gallop_ratio < static_cast<Scalar_size>(nb))
+      {
+        std::size_t lo = 0;
+        for (auto item: a)
+        {
+          std::size_t bound = 1;
+          while (lo + bound < nb && b[lo + bound] < item)
+            bound *= 2;
+
+          auto const hi = std::min(lo + bound + 1, nb);
+          lo = std::lower_bound(b.begin() + lo, b.begin() + hi, item) - b.begin();
+          if (lo == nb)
+            return;
+
+          if (b[lo] == item)
+          {
+            out(item);
+            ++lo;
+          }
+        }
+      }
+      else
+      {
+        // Advancing both indices by comparison results instead of branching on them.
+        std::size_t i = 0, j = 0;
+        while (i < na && j < nb)
+        {
+          auto const x = a[i], y = b[j];
+          if (x == y)
+            out(x);
+
+          i += x <= y;
+          j += y <= x;
+        }
+      }
+    }
+
+
+    /// Collects the items of a result set of the given implementation.
+    class Result_builder
+    {
+    public:
+      explicit Result_builder(Set_view const& like)
+      {
+        if (like.bits)
+          _set = std::make_unique<Index_set_bitvector>();
+        else if (like.hash)
+          _set = std::make_unique<Index_set_hashtable>();
+      }
+
+      void add(Scalar_index item)
+      {
+        if (_set)
+          _set->insert(item);
+        else
+          _sorted.push_back(item);
+      }
+
+      [[nodiscard]] auto finish()
+        -> Index_set_uptr
+      {
+        if (_set)
+          return std::move(_set);
+
+        if (!std::is_sorted(_sorted.begin(), _sorted.end()))
+          std::sort(_sorted.begin(), _sorted.end());
+        _sorted.erase(std::unique(_sorted.begin(), _sorted.end()), _sorted.end());
+        return std::make_unique<Index_set_sortedvector>(std::move(_sorted));
+      }
+
+    private:
+      Index_set_uptr            _set;
+      std::vector<Scalar_index> _sorted;
+    };
+
+
+    /// Combine words of two bit vectors into a new bit vector, result has as many words as a if keep_a_length.
+    template <typename Op>
+    auto combine_words(Index_set_bitvector const& a, Index_set_bitvector const& b, bool keep_a_length, Op op)
+      -> Index_set_uptr
+    {
+      auto const wa = a.words(), wb = b.words();
+      auto const length = keep_a_length? wa.size(): std::max(wa.size(), wb.size());
+
+      auto result = std::make_unique<Index_set_bitvector>();
+      result->reserve_words(static_cast<Scalar_size>(length));
+      auto const out = result->words();
+      for (std::size_t i = 0; i < length; ++i)
+        out[i] = op(i < wa.size()? wa[i]: Word{}, i < wb.size()? wb[i]: Word{});
+
+      return result;
+    }
+
+  }
+
+
+  auto intersection_count(Index_set const& a, Index_set const& b)
+    -> Scalar_size
+  {
+    auto const va = view(a), vb = view(b);
+
+    Scalar_size count = 0;
+    if (va.is_sorted && vb.is_sorted)
+    {
+      intersect_sorted(va.sorted, vb.sorted, [&count](Scalar_index) { ++count; });
+      return count;
+    }
+
+    if (va.bits && vb.bits)
+    {
+      auto const wa = va.bits->words(), wb = vb.bits->words();
+      for (std::size_t i = 0, length = std::min(wa.size(), wb.size()); i < length; ++i)
+        count += std::popcount(wa[i] & wb[i]);
+      return count;
+    }
+
+    auto const& [iterated, probed] = va.iteration_cost() <= vb.iteration_cost()
+      ? std::pair<Set_view const&, Set_view const&>(va, vb)
+      : std::pair<Set_view const&, Set_view const&>(vb, va);
+
+    with_probe(probed, [&](auto contains)
+      {
+        for_each_item(iterated, [&](Scalar_index item) { count += contains(item); });
+      });
+
+    return count;
+  }
+
+
+  auto set_intersection(Index_set const& a, Index_set const& b)
+    -> Index_set_uptr
+  {
+    auto const va = view(a), vb = view(b);
+
+    if (va.is_sorted && vb.is_sorted)
+    {
+      std::vector<Scalar_index> result;
+      result.reserve(std::min(va.sorted.size(), vb.sorted.size()));
+      intersect_sorted(va.sorted, vb.sorted, [&result](Scalar_index item) { result.push_back(item); });
+      return std::make_unique<Index_set_sortedvector>(std::move(result));
+    }
+
+    if (va.bits && vb.bits)
+      return combine_words(*va.bits, *vb.bits, true, [](Word x, Word y) { return x & y; });
+
+    auto const& [iterated, probed] = va.iteration_cost() <= vb.iteration_cost()
+      ? std::pair<Set_view const&, Set_view const&>(va, vb)
+      : std::pair<Set_view const&, Set_view const&>(vb, va);
+
+    Result_builder result(va);
+    with_probe(probed, [&](auto contains)
+      {
+        for_each_item(iterated, [&](Scalar_index item)
+          {
+            if (contains(item))
+              result.add(item);
+          });
+      });
+
+    return result.finish();
+  }
+
+
+  auto set_union(Index_set const& a, Index_set const& b)
+    -> Index_set_uptr
+  {
+    auto const va = view(a), vb = view(b);
+
+    if (va.is_sorted && vb.is_sorted)
+    {
+      std::vector<Scalar_index> result;
+      result.reserve(va.sorted.size() + vb.sorted.size());
+      std::set_union(
+        va.sorted.begin(), va.sorted.end(),
+        vb.sorted.begin(), vb.sorted.end(),
+        std::back_inserter(result));
+      return std::make_unique<Index_set_sortedvector>(std::move(result));
+    }
+
+    if (va.bits && vb.bits)
+      return combine_words(*va.bits, *vb.bits, false, [](Word x, Word y) { return x | y; });
+
+    Result_builder result(va);
+    for_each_item(va, [&](Scalar_index item) { result.add(item); });
+    for_each_item(vb, [&](Scalar_index item) { result.add(item); });
+    return result.finish();
+  }
+
+
+  auto set_difference(Index_set const& a, Index_set const& b)
+    -> Index_set_uptr
+  {
+    auto const va = view(a), vb = view(b);
+
+    if (va.is_sorted && vb.is_sorted)
+    {
+      std::vector<Scalar_index> result;
+      result.reserve(va.sorted.size());
+      std::set_difference(
+        va.sorted.begin(), va.sorted.end(),
+        vb.sorted.begin(), vb.sorted.end(),
+        std::back_inserter(result));
+      return std::make_unique<Index_set_sortedvector>(std::move(result));
+    }
+
+    if (va.bits && vb.bits)
+      return combine_words(*va.bits, *vb.bits, true, [](Word x, Word y) { return x & ~y; });
+
+    Result_builder result(va);
+    with_probe(vb, [&](auto contains)
+      {
+        for_each_item(va, [&](Scalar_index item)
+          {
+            if (!contains(item))
+              result.add(item);
+          });
+      });
+
+    return result.finish();
+  }
+
+
+  auto insert_all(Index_set& target, Index_set const& source)
+    -> Scalar_size
+  {
+    auto const vs = view(source);
+
+    if (auto const bits = dynamic_cast<Index_set_bitvector*>(&target); bits && vs.bits)
+    {
+      auto const ws = vs.bits->words();
+      bits->reserve_words(static_cast<Scalar_size>(ws.size()));
+
+      Scalar_size inserted = 0;
+      auto const wt = bits->words();
+      for (std::size_t i = 0; i < ws.size(); ++i)
+      {
+        inserted += std::popcount(ws[i] & ~wt[i]);
+        wt[i] |= ws[i];
+      }
+
+      return inserted;
+    }
+
+    if (auto const sv = dynamic_cast<Index_set_sortedvector*>(&target))
+    {
+      Sorted_items added = vs.sorted;
+      std::vector<Scalar_index> buffer;
+      if (!vs.is_sorted)
+      {
+        for_each_item(vs, [&buffer](Scalar_index item) { buffer.push_back(item); });
+        std::sort(buffer.begin(), buffer.end());
+        buffer.erase(std::unique(buffer.begin(), buffer.end()), buffer.end());
+        added = buffer;
+      }
+
+      auto const old = sv->items();
+      std::vector<Scalar_index> result;
+      result.reserve(old.size() + added.size());
+      std::set_union(old.begin(), old.end(), added.begin(), added.end(), std::back_inserter(result));
+
+      auto const inserted = static_cast<Scalar_size>(result.size() - old.size());
+      sv->assign(std::move(result));
+      return inserted;
+    }
+
+    Scalar_size inserted = 0;
+    for_each_item(vs, [&](Scalar_index item) { inserted += target.insert(item); });
+    return inserted;
+  }
+
+}
@@ -4,10 +4,45 @@
 #include "index_set_bitvector.hpp"
 #include <stdexcept>
 #include <algorithm>
+#include <bit>
 
 
 namespace ogxx {
 
+  namespace {
+
+    using Word = Index_set_bitvector::Word;
+    constexpr auto word_bits = Index_set_bitvector::word_bits;
+
+    /// Mask of bits first ... last - 1 of a word (0 <= first < last <= word_bits).
+    constexpr auto bit_range_mask(Scalar_index first, Scalar_index last) noexcept
+      -> Word
+    {
+      auto const upto_last = last == word_bits? ~Word{}: (Word{1} << last) - 1;
+      return upto_last & (~Word{} << first);
+    }
+
+    /// Apply op(word, mask) to the words covering items first ... last - 1, return the sum of op results.
+    template <typename Op>
+    auto for_each_word_range(std::span<Word> words, Scalar_index first, Scalar_index last, Op op)
+      -> Scalar_size
+    {
+      Scalar_size result = 0;
+      auto const first_word = first / word_bits;
+      auto const last_word  = (last - 1) / word_bits;
+      for (auto w = first_word; w <= last_word; ++w)
+      {
+        auto const from = w == first_word? first % word_bits: 0;
+        auto const to   = w == last_word? (last - 1) % word_bits + 1: word_bits;
+        result += op(words[w], bit_range_mask(from, to));
+      }
+
+      return result;
+    }
+
+  }
+
+
   Index_set_bitvector::Index_set_bitvector(Index_iterator_uptr ind)
   {
     std::vector<Scalar_index> buffer;
@@ -17,76 +52,152 @@ namespace ogxx {
     if (buffer.empty())
       return;
 
-    std::sort(buffer.begin(), buffer.end());
-    buffer.erase(std::unique(buffer.begin(), buffer.end()), buffer.end());
-    _bit_count = buffer.size();
-    _bits.resize(*std::max_element(buffer.begin(), buffer.end()) + 1);
+    auto const [min_item, max_item] = std::minmax_element(buffer.begin(), buffer.end());
+    if (*min_item < 0)
+      throw std::invalid_argument("Index_set_bitvector: negative items are not supported");
+
+    _words.resize(*max_item / word_bits + 1);
     for (Scalar_index item: buffer)
-      _bits[item] = true;
+      _words[item / word_bits] |= Word{1} << (item % word_bits);
   }
 
 
   bool Index_set_bitvector::contains(Scalar_index index) const noexcept {
-    return static_cast<size_t>(index) < _bits.size() && _bits[index];
+    return 0 <= index && index / word_bits < static_cast<Scalar_index>(_words.size())
+      && (_words[index / word_bits] >> (index % word_bits) & 1) != 0;
   }
 
   bool Index_set_bitvector::insert(Scalar_index item) {
     if (item < 0)
       throw std::invalid_argument("Index_set_bitvector::insert: negative items are not supported");
 
-    if (static_cast<size_t>(item) >= _bits.size())
-      _bits.resize(item + 1, false);
-    else if (_bits[item])
+    reserve_words(item / word_bits + 1);
+    auto& word = _words[item / word_bits];
+    auto const bit = Word{1} << (item % word_bits);
+    if (word & bit)
       return false;
 
-    _bits[item] = true;
-    ++_bit_count;
+    word |= bit;
     return true;
   }
 
   bool Index_set_bitvector::erase(Scalar_index item) {
-    if (static_cast<size_t>(item) >= _bits.size())
+    if (!contains(item))
       return false;
 
-    if (_bits[item])
-    {
-      _bits[item] = false;
-      --_bit_count;
-      return true;
-    }
+    _words[item / word_bits] &= ~(Word{1} << (item % word_bits));
+    return true;
+  }
 
-    return false;
+  Scalar_size Index_set_bitvector::size() const noexcept {
+    Scalar_size result = 0;
+    for (auto word: _words)
+      result += std::popcount(word);
+    return result;
   }
-    
+
+  bool Index_set_bitvector::is_empty() const noexcept {
+    return std::all_of(_words.begin(), _words.end(), [](Word word) { return word == 0; });
+  }
+
+
+  auto Index_set_bitvector::insert_range(Scalar_index first, Scalar_index last)
+    -> Scalar_size
+  {
+    if (first < 0)
+      throw std::invalid_argument("Index_set_bitvector::insert_range: negative items are not supported");
+    if (last <= first)
+      return 0;
+
+    reserve_words((last - 1) / word_bits + 1);
+    return for_each_word_range(_words, first, last, [](Word& word, Word mask)
+      {
+        auto const inserted = std::popcount(~word & mask);
+        word |= mask;
+        return inserted;
+      });
+  }
+
+  auto Index_set_bitvector::erase_range(Scalar_index first, Scalar_index last)
+    -> Scalar_size
+  {
+    first = max(first, Scalar_index(0));
+    last  = min(last, static_cast<Scalar_index>(_words.size()) * word_bits);
+    if (last <= first)
+      return 0;
+
+    return for_each_word_range(_words, first, last, [](Word& word, Word mask)
+      {
+        auto const erased = std::popcount(word & mask);
+        word &= ~mask;
+        return erased;
+      });
+  }
+
+  void Index_set_bitvector::reserve_words(Scalar_size word_count) {
+    if (static_cast<Scalar_size>(_words.size()) < word_count)
+      _words.resize(word_count);
+  }
+
 
   namespace {
 
+    /// Takes a word, then extracts its set bits lowest first by countr_zero, so zero bits cost nothing.
     class Bit_index_iterator
       : public Index_iterator
     {
     public:
-      Bit_index_iterator(std::vector<bool> const& bits)
-        : _cur(bits.begin()), _end(bits.end()) {}
+      Bit_index_iterator(std::span<Word const> words) noexcept
+        : _cur(words.data()), _end(words.data() + words.size())
+      {
+        if (_cur != _end)
+          _bits = *_cur;
+      }
 
-      bool next(Scalar_index& value) override
+      bool next(Scalar_index& value) noexcept override
       {
-        for (;; ++_cur, ++_item)
+        while (_bits == 0)
         {
-          if (_cur == _end)
+          if (_cur == _end || ++_cur == _end)
             return false;
-          if (*_cur)
+
+          _base += word_bits;
+          _bits  = *_cur;
+        }
+
+        value  = _base + std::countr_zero(_bits);
+        _bits &= _bits - 1;
+        return true;
+      }
+
+      Scalar_size next_batch(std::span<Scalar_index> values) noexcept override
+      {
+        Scalar_size written = 0;
+        auto const  count   = static_cast<Scalar_size>(values.size());
+        while (written < count)
+        {
+          if (_bits == 0)
           {
-            value = _item;
-            ++_item;
-            ++_cur;
-            return true;
+            if (_cur == _end || ++_cur == _end)
+              break;
+
+            _base += word_bits;
+            _bits  = *_cur;
+            continue;
           }
+
+          values[written++] = _base + std::countr_zero(_bits);
+          _bits &= _bits - 1;
         }
+
+        return written;
       }
 
     private:
-      std::vector<bool>::const_iterator _cur, _end;
-      Scalar_index _item = 0;
+      Word const*   _cur;
+      Word const*   _end;
+      Word          _bits = 0; ///< not yet visited bits of *_cur
+      Scalar_index  _base = 0; ///< item of bit 0 of *_cur
     };
 
   }
@@ -95,7 +206,13 @@ namespace ogxx {
   auto Index_set_bitvector::iterate() const
     -> Index_iterator_uptr
   {
-    return std::make_unique<Bit_index_iterator>(_bits);
+    return std::make_unique<Bit_index_iterator>(words());
+  }
+
+  auto Index_set_bitvector::iterate_handle() const
+    -> Index_iterator_handle
+  {
+    return make_iterator_handle<Bit_index_iterator>(words());
   }
 
 
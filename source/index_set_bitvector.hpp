@@ -7,16 +7,22 @@
 #include <ogxx/st_set.hpp>
 #include <ogxx/iterable.hpp>
 
+#include <cstdint>
+#include <span>
 #include <vector>
 
 
 namespace ogxx {
-  class Index_set_bitvector 
+  class Index_set_bitvector
     : public Index_set
     , public Sized_iterable<Scalar_index> {
+    public:
+      /// Bits are kept in 64-bit words, item i is bit i % 64 of word i / 64.
+      using Word = std::uint64_t;
+      static constexpr Scalar_size word_bits = 64;
+
     private:
-      std::vector<bool> _bits;
-      Scalar_size       _bit_count = 0;
+      std::vector<Word> _words;
 
     public:
       Index_set_bitvector() = default;
@@ -26,15 +32,30 @@ namespace ogxx {
       bool insert(Scalar_index item) override;
       bool erase(Scalar_index item) override;
 
-      Scalar_size size() const noexcept override {
-        return _bit_count;
-      }
+      /// @brief Count the items by popcount of the words.
+      Scalar_size size() const noexcept override;
 
-      bool is_empty() const noexcept override {
-        return _bit_count == 0;
-      }
+      bool is_empty() const noexcept override;
 
       auto iterate() const -> Index_iterator_uptr override;
+      auto iterate_handle() const -> Index_iterator_handle override;
+
+      /// @brief Insert all the items first, first + 1, ..., last - 1 setting whole words at once.
+      /// @return how many items have been inserted (were absent)
+      auto insert_range(Scalar_index first, Scalar_index last) -> Scalar_size;
+
+      /// @brief Erase all the items first, first + 1, ..., last - 1 clearing whole words at once.
+      /// @return how many items have been erased (were present)
+      auto erase_range(Scalar_index first, Scalar_index last) -> Scalar_size;
+
+      /// @brief Get the raw words (trailing words may be zero).
+      auto words() const noexcept -> std::span<Word const> { return _words; }
+
+      /// @brief Get the raw words for modification in place.
+      auto words() noexcept -> std::span<Word> { return _words; }
+
+      /// @brief Make room for items 0 ... word_count * word_bits - 1 (never shrinks).
+      void reserve_words(Scalar_size word_count);
   };
 
 }
@@ -39,6 +39,11 @@ namespace ogxx
         return new_stl_iterator(unord_set);
     }
 
+    auto Index_set_hashtable::iterate_handle() const -> Index_iterator_handle
+    {
+        return make_stl_iterator_handle(unord_set);
+    }
+
     
     auto new_index_set_hashtable() -> Index_set_uptr
     {
@@ -38,6 +38,9 @@ namespace ogxx
         [[nodiscard]] auto iterate() const 
           -> Basic_iterator_uptr<Scalar_index> override;
 
+        [[nodiscard]] auto iterate_handle() const
+          -> Index_iterator_handle override;
+
         [[nodiscard]] auto is_empty() const noexcept
           -> bool override 
         {
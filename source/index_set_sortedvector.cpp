@@ -42,6 +42,10 @@ namespace ogxx {
       return new_stl_iterator(sorted_vector);
   }
 
+  auto Index_set_sortedvector::iterate_handle() const -> Index_iterator_handle {
+      return make_stl_iterator_handle(sorted_vector);
+  }
+
   auto Index_set_sortedvector::get(Scalar_index index) const -> Scalar_index
   {
       if (static_cast<size_t>(index) >= sorted_vector.size())
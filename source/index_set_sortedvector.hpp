@@ -7,6 +7,7 @@
 #include <ogxx/st_set.hpp>
 #include <ogxx/iterable.hpp>
 
+#include <span>
 #include <vector>
 
 
@@ -22,6 +23,20 @@ namespace ogxx {
 
         explicit Index_set_sortedvector(Index_iterator_uptr elems);
 
+        /// @brief Take items which are already sorted and unique.
+        explicit Index_set_sortedvector(std::vector<Scalar_index> sorted_items) noexcept
+          : sorted_vector(std::move(sorted_items)) {}
+
+        /// @brief Get the sorted items.
+        [[nodiscard]] auto items() const noexcept
+          -> std::span<Scalar_index const> { return sorted_vector; }
+
+        /// @brief Replace the items by other items which are already sorted and unique.
+        void assign(std::vector<Scalar_index> sorted_items) noexcept
+        {
+            sorted_vector = std::move(sorted_items);
+        }
+
         auto insert(Scalar_index index) -> bool override;
 
         auto erase(Scalar_index index) -> bool override;
@@ -31,6 +46,9 @@ namespace ogxx {
         [[nodiscard]] auto iterate() const
           -> Basic_iterator_uptr<Scalar_index> override;
 
+        [[nodiscard]] auto iterate_handle() const
+          -> Index_iterator_handle override;
+
         [[nodiscard]] auto is_empty() const noexcept
           -> bool override
         {
@@ -0,0 +1,92 @@
+/// @file index_stack_queue.cpp
+/// @brief Stack and queue implementations of the Index_bag interface.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/iterable.hpp>
+#include <ogxx/stl_iterator.hpp>
+
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Last in, first out (Container is std::vector) or first in, first out (Container is std::deque).
+    template <typename Container>
+    class Index_sequence_bag final
+      : public Index_bag
+    {
+    public:
+      void put(Scalar_index item) override
+      {
+        _items.push_back(item);
+      }
+
+      auto take()
+        -> Scalar_index override
+      {
+        if (_items.empty())
+          throw std::runtime_error("Index_bag::take: the bag is empty");
+
+        Scalar_index item;
+        if constexpr (std::is_same_v<Container, std::vector<Scalar_index>>)
+        {
+          item = _items.back();
+          _items.pop_back();
+        }
+        else
+        {
+          item = _items.front();
+          _items.pop_front();
+        }
+
+        return item;
+      }
+
+      void clear() override
+      {
+        _items.clear();
+      }
+
+      [[nodiscard]] auto iterate() const
+        -> Index_iterator_uptr override
+      {
+        return new_stl_iterator(_items);
+      }
+
+      [[nodiscard]] auto is_empty() const noexcept
+        -> bool override
+      {
+        return _items.empty();
+      }
+
+      [[nodiscard]] auto size() const noexcept
+        -> Scalar_size override
+      {
+        return static_cast<Scalar_size>(_items.size());
+      }
+
+    private:
+      Container _items;
+    };
+
+  }
+
+
+  auto new_index_stack()
+    -> Index_bag_uptr
+  {
+    return std::make_unique<Index_sequence_bag<std::vector<Scalar_index>>>();
+  }
+
+  auto new_index_queue()
+    -> Index_bag_uptr
+  {
+    return std::make_unique<Index_sequence_bag<std::deque<Scalar_index>>>();
+  }
+
+}
@@ -0,0 +1,297 @@
+/// @file johnson.cpp
+/// @brief Johnson's all pairs shortest path algorithm implementation.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/johnson.hpp>
+#include <ogxx/floyd_warshall.hpp>
+#include "dense_st_matrix.hpp"
+#include "min_plus.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Sources given to a thread at once, they share one Dijkstra workspace.
+    constexpr Scalar_size johnson_sources_per_task = 16;
+
+    // Costs of a Dijkstra run per vertex (heap operations, writing the row) and per arc
+    // measured in Floyd-Warshall tile updates, see prefer_johnson.
+    constexpr Scalar_size johnson_vertex_cost = 800;
+    constexpr Scalar_size johnson_arc_cost    = 100;
+
+
+    /// Path lengths are accumulated in a wider type: potentials may exceed the range of Int.
+    template <typename ST>
+    using Wide = std::conditional_t<std::is_same_v<ST, Int>, std::int64_t, Float>;
+
+    template <typename W>
+    constexpr W unreachable = std::numeric_limits<W>::has_infinity
+      ? std::numeric_limits<W>::infinity()
+      : std::numeric_limits<W>::max();
+
+    /// Saturate a wide length into Int: int_infinity and above mean "no path".
+    inline auto narrow(std::int64_t length) noexcept
+      -> Int
+    {
+      if (length >= int_infinity)
+        return int_infinity;
+      if (length <= std::numeric_limits<Int>::min())
+        return std::numeric_limits<Int>::min();
+      return static_cast<Int>(length);
+    }
+
+    inline auto narrow(Float length) noexcept
+      -> Float
+    {
+      return length;
+    }
+
+
+    /// Outgoing arcs of all vertices in CSR layout with the weights in a parallel column.
+    template <typename W>
+    struct Weighted_arcs
+    {
+      std::vector<Scalar_index> offsets;
+      std::vector<Vertex_index> targets;
+      std::vector<W>            weights;
+
+      [[nodiscard]] auto vertex_count() const noexcept
+        -> Scalar_size { return static_cast<Scalar_size>(offsets.size()) - 1; }
+
+      [[nodiscard]] auto arc_count() const noexcept
+        -> Scalar_size { return static_cast<Scalar_size>(targets.size()); }
+    };
+
+    /// Copy the arcs of the graph widening the weights.
+    template <typename ST>
+    auto collect_arcs(Weighted_graph_view<ST> const& graph)
+      -> Weighted_arcs<Wide<ST>>
+    {
+      auto const csr = graph.weighted_csr();
+      Weighted_arcs<Wide<ST>> arcs;
+      arcs.offsets.assign(csr.offsets.begin(), csr.offsets.end());
+      arcs.targets.assign(csr.targets.begin(), csr.targets.end());
+      arcs.weights.assign(csr.weights.begin(), csr.weights.end());
+      if (arcs.offsets.empty())
+        arcs.offsets.push_back(0);
+      return arcs;
+    }
+
+
+    /// @brief Bellman-Ford (queue-based) from a virtual source connected to all the vertices by zero arcs.
+    /// @return potentials h such that w(u, v) + h(u) - h(v) >= 0 for each arc
+    template <typename W>
+    auto potentials(Weighted_arcs<W> const& arcs)
+      -> std::vector<W>
+    {
+      auto const n = arcs.vertex_count();
+      std::vector<W> h(n, W{});
+      if (std::none_of(arcs.weights.begin(), arcs.weights.end(), [](W w) { return w < W{}; }))
+        return h;
+
+      std::deque<Vertex_index>  queue;
+      std::vector<char>         is_queued(n, 1);
+      std::vector<Scalar_size>  enqueued(n, 1);
+      for (Vertex_index v = 0; v < n; ++v)
+        queue.push_back(v);
+
+      while (!queue.empty())
+      {
+        auto const u = queue.front();
+        queue.pop_front();
+        is_queued[u] = 0;
+
+        for (auto a = arcs.offsets[u], a_end = arcs.offsets[u + 1]; a < a_end; ++a)
+        {
+          auto const v = arcs.targets[a];
+          if (auto const hv = h[u] + arcs.weights[a]; hv < h[v])
+          {
+            h[v] = hv;
+            if (!is_queued[v])
+            {
+              // A vertex may be improved at most n times (n + 1 vertices with the virtual source).
+              if (++enqueued[v] > n + 1)
+                throw std::invalid_argument("johnson: the graph has a negative cycle.");
+
+              is_queued[v] = 1;
+              queue.push_back(v);
+            }
+          }
+        }
+      }
+
+      return h;
+    }
+
+
+    /// Dijkstra buffers reused for several sources.
+    template <typename W>
+    class Dijkstra_workspace
+    {
+    public:
+      /// Compute distances from the source over non-negative weights.
+      auto run(Weighted_arcs<W> const& arcs, std::vector<W> const& reweighted, Vertex_index source)
+        -> std::vector<W> const&
+      {
+        _distances.assign(arcs.vertex_count(), unreachable<W>);
+        _distances[source] = W{};
+        _heap.clear();
+        _heap.emplace_back(W{}, source);
+
+        while (!_heap.empty())
+        {
+          std::pop_heap(_heap.begin(), _heap.end(), std::greater<>{});
+          auto const [du, u] = _heap.back();
+          _heap.pop_back();
+          if (_distances[u] < du)
+            continue; // stale entry
+
+          for (auto a = arcs.offsets[u], a_end = arcs.offsets[u + 1]; a < a_end; ++a)
+          {
+            auto const v = arcs.targets[a];
+            if (auto const dv = du + reweighted[a]; dv < _distances[v])
+            {
+              _distances[v] = dv;
+              _heap.emplace_back(dv, v);
+              std::push_heap(_heap.begin(), _heap.end(), std::greater<>{});
+            }
+          }
+        }
+
+        return _distances;
+      }
+
+    private:
+      std::vector<W>                          _distances;
+      std::vector<std::pair<W, Vertex_index>> _heap;
+    };
+
+
+    template <typename ST>
+    auto johnson_ST(Weighted_graph_view<ST> const& graph, Thread_pool& pool)
+      -> St_matrix_uptr<ST>
+    {
+      using W = Wide<ST>;
+      auto const arcs = collect_arcs(graph);
+      auto const n    = arcs.vertex_count();
+      auto const h    = potentials(arcs);
+
+      std::vector<W> reweighted(arcs.arc_count());
+      for (Vertex_index u = 0; u < n; ++u)
+        for (auto a = arcs.offsets[u], a_end = arcs.offsets[u + 1]; a < a_end; ++a)
+          reweighted[a] = max(W{}, arcs.weights[a] + h[u] - h[arcs.targets[a]]); // rounding may go below 0
+
+      auto result = new_dense_st_matrix<ST>({ n, n });
+      auto const d = static_cast<Dense_st_matrix<ST>&>(*result).data();
+
+      auto const tasks = (n + johnson_sources_per_task - 1) / johnson_sources_per_task;
+      pool.parallel_for(tasks, [&](Scalar_index task)
+        {
+          Dijkstra_workspace<W> workspace;
+          auto const first = task * johnson_sources_per_task;
+          for (auto s = first, last = min(first + johnson_sources_per_task, n); s < last; ++s)
+          {
+            auto const& distances = workspace.run(arcs, reweighted, s);
+            auto const  row       = d + s * n;
+            for (Vertex_index v = 0; v < n; ++v)
+              row[v] = distances[v] == unreachable<W>
+                ? no_path_length<ST>
+                : narrow(distances[v] - h[s] + h[v]);
+          }
+        });
+
+      return result;
+    }
+
+
+    template <typename ST>
+    auto all_pairs_shortest_paths_ST(Weighted_graph_view<ST> const& graph, Thread_pool& pool)
+      -> St_matrix_uptr<ST>
+    {
+      auto const csr = graph.weighted_csr();
+      auto const n   = graph.vertex_count();
+      if (prefer_johnson(n, static_cast<Scalar_size>(csr.targets.size())))
+        return johnson_ST(graph, pool);
+
+      // Floyd-Warshall over the matrix of the arcs only.
+      auto lengths = new_dense_st_matrix<ST>({ n, n });
+      lengths->fill(no_path_length<ST>);
+      for (Vertex_index u = 0; u < n; ++u)
+      {
+        lengths->set(u, u, ST{});
+        auto const [targets, weights] = csr.weighted_neighbors(u);
+        for (Scalar_index a = 0; a < static_cast<Scalar_index>(targets.size()); ++a)
+          lengths->set(u, targets[a], min(lengths->get(u, targets[a]), weights[a]));
+      }
+
+      return floyd_warshall_only_matrix(*lengths, pool);
+    }
+
+  }
+
+
+  auto johnson(Int_weighted_graph_view const& graph, Thread_pool& pool)
+    -> Int_matrix_uptr
+  {
+    return johnson_ST(graph, pool);
+  }
+
+  auto johnson(Float_weighted_graph_view const& graph, Thread_pool& pool)
+    -> Float_matrix_uptr
+  {
+    return johnson_ST(graph, pool);
+  }
+
+  auto johnson(Graph_view const& graph, Int_matrix const& weights, Thread_pool& pool)
+    -> Int_matrix_uptr
+  {
+    return johnson_ST(*new_weighted_graph_view(graph, weights), pool);
+  }
+
+  auto johnson(Graph_view const& graph, Float_matrix const& weights, Thread_pool& pool)
+    -> Float_matrix_uptr
+  {
+    return johnson_ST(*new_weighted_graph_view(graph, weights), pool);
+  }
+
+
+  auto prefer_johnson(Scalar_size vertex_count, Scalar_size arc_count) noexcept
+    -> bool
+  {
+    // V Dijkstra runs against V^3 updates.
+    return johnson_vertex_cost * vertex_count + johnson_arc_cost * arc_count < vertex_count * vertex_count;
+  }
+
+
+  auto all_pairs_shortest_paths(Int_weighted_graph_view const& graph, Thread_pool& pool)
+    -> Int_matrix_uptr
+  {
+    return all_pairs_shortest_paths_ST(graph, pool);
+  }
+
+  auto all_pairs_shortest_paths(Float_weighted_graph_view const& graph, Thread_pool& pool)
+    -> Float_matrix_uptr
+  {
+    return all_pairs_shortest_paths_ST(graph, pool);
+  }
+
+  auto all_pairs_shortest_paths(Graph_view const& graph, Int_matrix const& weights, Thread_pool& pool)
+    -> Int_matrix_uptr
+  {
+    return all_pairs_shortest_paths_ST(*new_weighted_graph_view(graph, weights), pool);
+  }
+
+  auto all_pairs_shortest_paths(Graph_view const& graph, Float_matrix const& weights, Thread_pool& pool)
+    -> Float_matrix_uptr
+  {
+    return all_pairs_shortest_paths_ST(*new_weighted_graph_view(graph, weights), pool);
+  }
+
+}
@@ -0,0 +1,340 @@
+/// @file min_plus.cpp
+/// @brief Min-plus tile update kernels: portable scalar ones and AVX2/AVX-512 ones selected at run time.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include "min_plus.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define OGXX_MIN_PLUS_X86
+#include <immintrin.h>
+#endif
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Update rows [i0, i1), columns [j0, j1) through the vertex k (and next hops if next is not null).
+    template <typename ST>
+    using Rows_kernel = void (*)(ST* d, Int* next, Scalar_size n,
+      Scalar_index i0, Scalar_index i1,
+      Scalar_index j0, Scalar_index j1,
+      Scalar_index k) noexcept;
+
+
+    /// Update row[j] for j in [j0, j1), next_row is null if not with_next.
+    template <bool with_next, typename ST>
+    inline void min_plus_row_scalar(ST* row, Int* next_row, ST const* via, ST through, Int hop,
+      Scalar_index j0, Scalar_index j1) noexcept
+    {
+      for (auto j = j0; j < j1; ++j)
+      {
+        if constexpr (with_next)
+        {
+          if (auto const sum = saturating_add(through, via[j]); sum < row[j])
+          {
+            row[j]      = sum;
+            next_row[j] = hop;
+          }
+        }
+        else
+        {
+          row[j] = min(row[j], saturating_add(through, via[j]));
+        }
+      }
+    }
+
+    template <bool with_next, typename ST>
+    void min_plus_rows_scalar(ST* d, Int* next, Scalar_size n,
+      Scalar_index i0, Scalar_index i1,
+      Scalar_index j0, Scalar_index j1,
+      Scalar_index k) noexcept
+    {
+      auto const via = d + k * n;
+      for (auto i = i0; i < i1; ++i)
+      {
+        auto const row = d + i * n;
+        if (auto const through = row[k]; through != no_path_length<ST>)
+        {
+          if constexpr (with_next)
+            min_plus_row_scalar<true>(row, next + i * n, via, through, next[i * n + k], j0, j1);
+          else
+            min_plus_row_scalar<false>(row, nullptr, via, through, Int{}, j0, j1);
+        }
+      }
+    }
+
+
+#ifdef OGXX_MIN_PLUS_X86
+
+    // Int lanes: the sum overflows iff its sign differs from the signs of both the terms (which are equal then),
+    // and it saturates to the lowest Int for negative terms or to int_infinity for non-negative ones.
+    // Lanes of via being int_infinity stay int_infinity (through is never int_infinity here).
+    // Next hops are written by masked stores where the sum is less than the old value.
+
+    template <bool with_next>
+    __attribute__((target("avx2")))
+    void min_plus_rows_avx2(Int* d, Int* next, Scalar_size n,
+      Scalar_index i0, Scalar_index i1,
+      Scalar_index j0, Scalar_index j1,
+      Scalar_index k) noexcept
+    {
+      auto const via = d + k * n;
+      auto const inf = _mm256_set1_epi32(int_infinity);
+      for (auto i = i0; i < i1; ++i)
+      {
+        auto const row      = d + i * n;
+        auto const next_row = with_next? next + i * n: nullptr;
+        auto const through  = row[k];
+        if (through == int_infinity)
+          continue;
+
+        auto const hop       = with_next? next_row[k]: Int{};
+        auto const hops      = _mm256_set1_epi32(hop);
+        auto const t         = _mm256_set1_epi32(through);
+        auto const saturated = _mm256_xor_si256(_mm256_srai_epi32(t, 31), inf);
+
+        auto j = j0;
+        for (; j + 8 <= j1; j += 8)
+        {
+          auto const v   = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(via + j));
+          auto const r   = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(row + j));
+          auto       sum = _mm256_add_epi32(t, v);
+
+          auto const overflow = _mm256_srai_epi32(
+            _mm256_and_si256(_mm256_xor_si256(v, sum), _mm256_xor_si256(t, sum)), 31);
+          sum = _mm256_blendv_epi8(sum, saturated, overflow);
+          sum = _mm256_blendv_epi8(sum, inf, _mm256_cmpeq_epi32(v, inf));
+
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + j), _mm256_min_epi32(r, sum));
+          if constexpr (with_next)
+            _mm256_maskstore_epi32(next_row + j, _mm256_cmpgt_epi32(r, sum), hops);
+        }
+
+        min_plus_row_scalar<with_next>(row, next_row, via, through, hop, j, j1);
+      }
+    }
+
+    template <bool with_next>
+    __attribute__((target("avx2")))
+    void min_plus_rows_avx2(Float* d, Int* next, Scalar_size n,
+      Scalar_index i0, Scalar_index i1,
+      Scalar_index j0, Scalar_index j1,
+      Scalar_index k) noexcept
+    {
+      auto const via = d + k * n;
+      auto const even_lanes = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+      for (auto i = i0; i < i1; ++i)
+      {
+        auto const row      = d + i * n;
+        auto const next_row = with_next? next + i * n: nullptr;
+        auto const through  = row[k];
+        if (through == infinity)
+          continue;
+
+        auto const hop  = with_next? next_row[k]: Int{};
+        auto const hops = _mm_set1_epi32(hop);
+        auto const t    = _mm256_set1_pd(through);
+        auto j = j0;
+        for (; j + 4 <= j1; j += 4)
+        {
+          // min_pd(a, b) is a < b? a: b like ogxx::min(b, a).
+          auto const sum = _mm256_add_pd(t, _mm256_loadu_pd(via + j));
+          auto const r   = _mm256_loadu_pd(row + j);
+          _mm256_storeu_pd(row + j, _mm256_min_pd(sum, r));
+
+          if constexpr (with_next)
+          {
+            // Pack the 64-bit lane masks into 32-bit ones.
+            auto const better = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(
+              _mm256_castpd_si256(_mm256_cmp_pd(sum, r, _CMP_LT_OQ)), even_lanes));
+            _mm_maskstore_epi32(next_row + j, better, hops);
+          }
+        }
+
+        min_plus_row_scalar<with_next>(row, next_row, via, through, hop, j, j1);
+      }
+    }
+
+    template <bool with_next>
+    __attribute__((target("avx512f")))
+    void min_plus_rows_avx512(Int* d, Int* next, Scalar_size n,
+      Scalar_index i0, Scalar_index i1,
+      Scalar_index j0, Scalar_index j1,
+      Scalar_index k) noexcept
+    {
+      auto const via  = d + k * n;
+      auto const inf  = _mm512_set1_epi32(int_infinity);
+      auto const zero = _mm512_setzero_si512();
+      for (auto i = i0; i < i1; ++i)
+      {
+        auto const row      = d + i * n;
+        auto const next_row = with_next? next + i * n: nullptr;
+        auto const through  = row[k];
+        if (through == int_infinity)
+          continue;
+
+        auto const hop       = with_next? next_row[k]: Int{};
+        auto const hops      = _mm512_set1_epi32(hop);
+        auto const t         = _mm512_set1_epi32(through);
+        auto const saturated = _mm512_xor_si512(_mm512_srai_epi32(t, 31), inf);
+
+        auto j = j0;
+        for (; j + 16 <= j1; j += 16)
+        {
+          auto const v   = _mm512_loadu_si512(via + j);
+          auto const r   = _mm512_loadu_si512(row + j);
+          auto       sum = _mm512_add_epi32(t, v);
+
+          auto const overflow = _mm512_cmplt_epi32_mask(
+            _mm512_and_si512(_mm512_xor_si512(v, sum), _mm512_xor_si512(t, sum)), zero);
+          sum = _mm512_mask_blend_epi32(overflow, sum, saturated);
+          sum = _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(v, inf), sum, inf);
+
+          _mm512_storeu_si512(row + j, _mm512_min_epi32(r, sum));
+          if constexpr (with_next)
+            _mm512_mask_storeu_epi32(next_row + j, _mm512_cmplt_epi32_mask(sum, r), hops);
+        }
+
+        min_plus_row_scalar<with_next>(row, next_row, via, through, hop, j, j1);
+      }
+    }
+
+    template <bool with_next>
+    __attribute__((target("avx512f")))
+    void min_plus_rows_avx512(Float* d, Int* next, Scalar_size n,
+      Scalar_index i0, Scalar_index i1,
+      Scalar_index j0, Scalar_index j1,
+      Scalar_index k) noexcept
+    {
+      auto const via = d + k * n;
+      for (auto i = i0; i < i1; ++i)
+      {
+        auto const row      = d + i * n;
+        auto const next_row = with_next? next + i * n: nullptr;
+        auto const through  = row[k];
+        if (through == infinity)
+          continue;
+
+        auto const hop  = with_next? next_row[k]: Int{};
+        auto const hops = _mm512_set1_epi32(hop);
+        auto const t    = _mm512_set1_pd(through);
+        auto j = j0;
+        for (; j + 8 <= j1; j += 8)
+        {
+          auto const sum = _mm512_add_pd(t, _mm512_loadu_pd(via + j));
+          auto const r   = _mm512_loadu_pd(row + j);
+          _mm512_storeu_pd(row + j, _mm512_min_pd(sum, r));
+
+          // The mask of 8 double lanes selects the 8 low Int lanes.
+          if constexpr (with_next)
+            _mm512_mask_storeu_epi32(next_row + j, _mm512_cmp_pd_mask(sum, r, _CMP_LT_OQ), hops);
+        }
+
+        min_plus_row_scalar<with_next>(row, next_row, via, through, hop, j, j1);
+      }
+    }
+
+#endif
+
+
+    template <bool with_next, typename ST>
+    auto rows_kernel(Min_plus_isa isa) noexcept
+      -> Rows_kernel<ST>
+    {
+#ifdef OGXX_MIN_PLUS_X86
+      switch (isa)
+      {
+      case Min_plus_isa::avx512: return min_plus_rows_avx512<with_next>;
+      case Min_plus_isa::avx2:   return min_plus_rows_avx2<with_next>;
+      default:                   break;
+      }
+#endif
+      return min_plus_rows_scalar<with_next, ST>;
+    }
+
+    template <typename ST>
+    void min_plus_tile_impl(ST* d, Int* next, Scalar_size n,
+      Scalar_index i0, Scalar_index i1,
+      Scalar_index j0, Scalar_index j1,
+      Scalar_index k0, Scalar_index k1,
+      Min_plus_isa isa) noexcept
+    {
+      if (!is_supported(isa))
+        isa = Min_plus_isa::scalar;
+
+      auto const kernel = next? rows_kernel<true, ST>(isa): rows_kernel<false, ST>(isa);
+      for (auto k = k0; k < k1; ++k)
+        kernel(d, next, n, i0, i1, j0, j1, k);
+    }
+
+  }
+
+
+  auto is_supported(Min_plus_isa isa) noexcept
+    -> bool
+  {
+    switch (isa)
+    {
+    case Min_plus_isa::scalar:
+      return true;
+#ifdef OGXX_MIN_PLUS_X86
+    case Min_plus_isa::avx2:
+      return __builtin_cpu_supports("avx2");
+    case Min_plus_isa::avx512:
+      return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+      return false;
+    }
+  }
+
+  auto min_plus_isa() noexcept
+    -> Min_plus_isa
+  {
+    static Min_plus_isa const best =
+        is_supported(Min_plus_isa::avx512)? Min_plus_isa::avx512
+      : is_supported(Min_plus_isa::avx2)?   Min_plus_isa::avx2
+      :                                     Min_plus_isa::scalar;
+    return best;
+  }
+
+
+  void min_plus_tile(Int* d, Scalar_size n,
+    Scalar_index i0, Scalar_index i1,
+    Scalar_index j0, Scalar_index j1,
+    Scalar_index k0, Scalar_index k1,
+    Min_plus_isa isa) noexcept
+  {
+    min_plus_tile_impl(d, nullptr, n, i0, i1, j0, j1, k0, k1, isa);
+  }
+
+  void min_plus_tile(Float* d, Scalar_size n,
+    Scalar_index i0, Scalar_index i1,
+    Scalar_index j0, Scalar_index j1,
+    Scalar_index k0, Scalar_index k1,
+    Min_plus_isa isa) noexcept
+  {
+    min_plus_tile_impl(d, nullptr, n, i0, i1, j0, j1, k0, k1, isa);
+  }
+
+  void min_plus_tile(Int* d, Int* next, Scalar_size n,
+    Scalar_index i0, Scalar_index i1,
+    Scalar_index j0, Scalar_index j1,
+    Scalar_index k0, Scalar_index k1,
+    Min_plus_isa isa) noexcept
+  {
+    min_plus_tile_impl(d, next, n, i0, i1, j0, j1, k0, k1, isa);
+  }
+
+  void min_plus_tile(Float* d, Int* next, Scalar_size n,
+    Scalar_index i0, Scalar_index i1,
+    Scalar_index j0, Scalar_index j1,
+    Scalar_index k0, Scalar_index k1,
+    Min_plus_isa isa) noexcept
+  {
+    min_plus_tile_impl(d, next, n, i0, i1, j0, j1, k0, k1, isa);
+  }
+
+}
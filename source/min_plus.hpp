@@ -0,0 +1,85 @@
+/// @file source/min_plus.hpp
+/// @brief Min-plus (tropical) tile update kernels for shortest path algorithms over dense row-major matrices.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_MIN_PLUS_HPP_INCLUDED
+#define OGXX_MIN_PLUS_HPP_INCLUDED
+
+#include <ogxx/primitive_definitions.hpp>
+
+
+namespace ogxx
+{
+
+  /// @brief Path length addition keeping "no path" values: int_infinity plus anything is int_infinity,
+  /// other sums are clamped to [lowest Int, int_infinity] instead of overflowing.
+  [[nodiscard]] constexpr auto saturating_add(Int a, Int b) noexcept
+    -> Int
+  {
+    if (a == int_infinity || b == int_infinity)
+      return int_infinity;
+
+    auto const sum = std::int64_t(a) + b;
+    if (sum >= int_infinity)
+      return int_infinity;
+    if (sum <= std::numeric_limits<Int>::min())
+      return std::numeric_limits<Int>::min();
+    return static_cast<Int>(sum);
+  }
+
+  /// @brief Path length addition for Float: IEEE arithmetic already keeps infinity.
+  [[nodiscard]] constexpr auto saturating_add(Float a, Float b) noexcept
+    -> Float
+  {
+    return a + b;
+  }
+
+  /// @brief Instruction sets the kernels are written for.
+  enum class Min_plus_isa
+  {
+    scalar,
+    avx2,
+    avx512,
+  };
+
+  /// @brief Check if the processor runs the kernels of the instruction set.
+  [[nodiscard]] auto is_supported(Min_plus_isa isa) noexcept
+    -> bool;
+
+  /// @brief The best supported instruction set, detected once.
+  [[nodiscard]] auto min_plus_isa() noexcept
+    -> Min_plus_isa;
+
+  /// @brief For k in [k0, k1) (outer loop), i in [i0, i1), j in [j0, j1):
+  /// d[i][j] = min(d[i][j], saturating_add(d[i][k], d[k][j])) over a row-major n x n array d.
+  /// Rows with d[i][k] being "no path" are skipped. The tile may overlap the row k and the column k.
+  void min_plus_tile(Int* d, Scalar_size n,
+    Scalar_index i0, Scalar_index i1,
+    Scalar_index j0, Scalar_index j1,
+    Scalar_index k0, Scalar_index k1,
+    Min_plus_isa isa = min_plus_isa()) noexcept;
+
+  /// @brief Same as the Int version for Float.
+  void min_plus_tile(Float* d, Scalar_size n,
+    Scalar_index i0, Scalar_index i1,
+    Scalar_index j0, Scalar_index j1,
+    Scalar_index k0, Scalar_index k1,
+    Min_plus_isa isa = min_plus_isa()) noexcept;
+
+  /// @brief Same as min_plus_tile without next, and next[i][j] = next[i][k] where d[i][j] gets less.
+  /// @param next row-major n x n next hop array
+  void min_plus_tile(Int* d, Int* next, Scalar_size n,
+    Scalar_index i0, Scalar_index i1,
+    Scalar_index j0, Scalar_index j1,
+    Scalar_index k0, Scalar_index k1,
+    Min_plus_isa isa = min_plus_isa()) noexcept;
+
+  /// @brief Same as the Int version for Float.
+  void min_plus_tile(Float* d, Int* next, Scalar_size n,
+    Scalar_index i0, Scalar_index i1,
+    Scalar_index j0, Scalar_index j1,
+    Scalar_index k0, Scalar_index k1,
+    Min_plus_isa isa = min_plus_isa()) noexcept;
+
+}
+
+#endif//OGXX_MIN_PLUS_HPP_INCLUDED
@@ -0,0 +1,274 @@
+/// @file multi_source_bfs.cpp
+/// @brief Multi-source bit-parallel breadth-first search implementation.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/multi_source_bfs.hpp>
+#include <ogxx/adjacency_list.hpp>
+#include "dense_st_matrix.hpp"
+#include "transposed_csr.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    using Word = std::uint64_t;
+    constexpr Scalar_size word_bits = 64;
+
+    /// Use 256-source batches only if there are enough of them to keep the threads busy.
+    constexpr Scalar_size wide_batches_per_thread = 2;
+
+
+    /// One bit per source of a batch, operations on 4 words are vectorized by the compiler.
+    template <Scalar_size words>
+    struct Source_bits
+    {
+      std::array<Word, words> w {};
+
+      [[nodiscard]] auto any() const noexcept
+        -> bool
+      {
+        Word result = 0;
+        for (auto x: w)
+          result |= x;
+        return result != 0;
+      }
+
+      void set(Scalar_index bit) noexcept
+      {
+        w[bit / word_bits] |= Word(1) << (bit % word_bits);
+      }
+
+      auto operator|=(Source_bits const& other) noexcept
+        -> Source_bits&
+      {
+        for (Scalar_index i = 0; i < words; ++i)
+          w[i] |= other.w[i];
+        return *this;
+      }
+
+      /// Bits of this not set in other.
+      [[nodiscard]] auto minus(Source_bits const& other) const noexcept
+        -> Source_bits
+      {
+        Source_bits result;
+        for (Scalar_index i = 0; i < words; ++i)
+          result.w[i] = w[i] & ~other.w[i];
+        return result;
+      }
+
+      /// Call f(bit) for each bit set.
+      template <typename F>
+      void for_each(F&& f) const
+      {
+        for (Scalar_index i = 0; i < words; ++i)
+          for (auto x = w[i]; x != 0; x &= x - 1)
+            f(i * word_bits + std::countr_zero(x));
+      }
+    };
+
+
+    /// Run the searches from up to 64 * words sources at once, report(source_index_in_batch, vertex, hops)
+    /// is called once for each vertex reached by each search.
+    template <Scalar_size words, typename Report>
+    void run_batch(Csr_view const& csr, Scalar_size n, std::span<Vertex_index const> batch, Report&& report)
+    {
+      using Bits = Source_bits<words>;
+      std::vector<Bits> seen(n), visit(n), next(n);
+
+      for (Scalar_index i = 0, count = static_cast<Scalar_size>(batch.size()); i < count; ++i)
+      {
+        auto const s = batch[i];
+        seen[s].set(i);
+        visit[s].set(i);
+        report(i, s, Int{});
+      }
+
+      auto const csr_n = min(n, csr.vertex_count());
+      for (Int hops = 1; ; ++hops)
+      {
+        // Push the searches standing at v to its neighbors, one scan for all the searches.
+        for (Vertex_index v = 0; v < csr_n; ++v)
+        {
+          if (!visit[v].any())
+            continue;
+          for (auto u: csr.neighbors(v))
+            next[u] |= visit[v];
+        }
+
+        // Keep only the searches reaching u for the first time.
+        bool is_going_on = false;
+        for (Vertex_index u = 0; u < n; ++u)
+        {
+          auto const fresh = next[u].minus(seen[u]);
+          next[u] = Bits{};
+          visit[u] = fresh;
+          if (!fresh.any())
+            continue;
+
+          is_going_on = true;
+          seen[u] |= fresh;
+          fresh.for_each([&](Scalar_index i) { report(i, u, hops); });
+        }
+
+        if (!is_going_on)
+          break;
+      }
+    }
+
+
+    void check_sources(std::span<Vertex_index const> sources, Scalar_size n)
+    {
+      for (auto s: sources)
+        if (s < 0 || s >= n)
+          throw std::out_of_range("multi_source_bfs: source vertex index out of range.");
+    }
+
+    /// Split the sources into batches and run them in parallel,
+    /// report(source_index, vertex, hops) is called concurrently for different sources.
+    template <typename Report>
+    void run_batches(Csr_view const& csr, Scalar_size n, std::span<Vertex_index const> sources, Thread_pool& pool, Report&& report)
+    {
+      auto const run = [&]<Scalar_size words>()
+        {
+          constexpr auto width = words * word_bits;
+          auto const count   = static_cast<Scalar_size>(sources.size());
+          auto const batches = (count + width - 1) / width;
+          pool.parallel_for(batches, [&](Scalar_index b)
+            {
+              auto const first = b * width;
+              auto const batch = sources.subspan(first, min(width, count - first));
+              run_batch<words>(csr, n, batch, [&](Scalar_index i, Vertex_index v, Int hops)
+                {
+                  report(first + i, v, hops);
+                });
+            });
+        };
+
+      auto const wide = Scalar_size(4) * word_bits;
+      if (static_cast<Scalar_size>(sources.size()) >= wide * wide_batches_per_thread * pool.thread_count())
+        run.template operator()<4>();
+      else
+        run.template operator()<1>();
+    }
+
+
+    /// Rows of a dense matrix are filled directly.
+    void multi_source_bfs_dense(Graph_view const& graph, std::span<Vertex_index const> sources,
+        Dense_st_matrix<Int>& distances, Thread_pool& pool)
+    {
+      auto const n = graph.vertex_count();
+      check_sources(sources, n);
+      Adjacency_list_uptr converted;
+      auto const csr = csr_view_or_convert(graph, converted);
+
+      auto const cols = distances.shape().cols;
+      auto const d    = distances.data();
+      auto const rows = static_cast<Scalar_size>(sources.size());
+      pool.parallel_for(rows, [&](Scalar_index row)
+        {
+          std::fill(d + row * cols, d + (row + 1) * cols, int_infinity);
+        });
+
+      run_batches(csr, n, sources, pool, [&](Scalar_index row, Vertex_index v, Int hops)
+        {
+          d[row * cols + v] = hops;
+        });
+    }
+
+  }
+
+
+  void multi_source_bfs(Graph_view const& graph, std::span<Vertex_index const> sources,
+      Int_matrix& distances, Thread_pool& pool)
+  {
+    auto const shape = distances.shape();
+    auto const n     = graph.vertex_count();
+    auto const rows  = static_cast<Scalar_size>(sources.size());
+    if (shape.rows < rows || shape.cols < n)
+      throw std::invalid_argument("multi_source_bfs: the distance matrix is less than sources x vertices.");
+
+    if (auto const dense = dynamic_cast<Dense_st_matrix<Int>*>(&distances))
+    {
+      multi_source_bfs_dense(graph, sources, *dense, pool);
+      return;
+    }
+
+    auto const buffer = multi_source_bfs(graph, sources, pool);
+    for (Scalar_index row = 0; row < rows; ++row)
+      for (Vertex_index v = 0; v < n; ++v)
+        distances.set(row, v, buffer->get(row, v));
+  }
+
+  auto multi_source_bfs(Graph_view const& graph, std::span<Vertex_index const> sources,
+      Thread_pool& pool)
+    -> Int_matrix_uptr
+  {
+    auto result = new_dense_st_matrix<Int>({ static_cast<Scalar_size>(sources.size()), graph.vertex_count() });
+    multi_source_bfs_dense(graph, sources, static_cast<Dense_st_matrix<Int>&>(*result), pool);
+    return result;
+  }
+
+
+  auto multi_source_bfs_summary(Graph_view const& graph, std::span<Vertex_index const> sources,
+      Thread_pool& pool)
+    -> std::vector<Hop_summary>
+  {
+    auto const n = graph.vertex_count();
+    check_sources(sources, n);
+    Adjacency_list_uptr converted;
+    auto const csr = csr_view_or_convert(graph, converted);
+
+    std::vector<Hop_summary> summaries(sources.size());
+    run_batches(csr, n, sources, pool, [&](Scalar_index i, Vertex_index, Int hops)
+      {
+        auto& summary = summaries[i];
+        ++summary.reached;
+        summary.distance_sum += hops;
+        summary.eccentricity  = max(summary.eccentricity, hops);
+      });
+
+    return summaries;
+  }
+
+
+
+  auto all_pairs_hop_distances(Graph_view const& graph, Thread_pool& pool)
+    -> Int_matrix_uptr
+  {
+    auto const n = graph.vertex_count();
+    auto result = new_dense_st_matrix<Int>({ n, n });
+    auto const d = static_cast<Dense_st_matrix<Int>&>(*result).data();
+    pool.parallel_for(n, [&](Scalar_index row)
+      {
+        std::fill(d + row * n, d + (row + 1) * n, int_infinity);
+      });
+
+    // Searching from s along the reversed arcs reaches v in hops(v, s), so a batch of sources fills
+    // a tile of adjacent columns instead of scattering over its rows.
+    Adjacency_list_uptr converted;
+    auto const csr = csr_view_or_convert(graph, converted);
+    Transposed_csr transposed;
+    if (graph.is_directed())
+      transposed = transpose(csr, n);
+
+    std::vector<Vertex_index> sources(n);
+    std::iota(sources.begin(), sources.end(), Vertex_index{});
+    run_batches(graph.is_directed()? transposed.view(): csr, n, sources, pool,
+      [&](Scalar_index source, Vertex_index v, Int hops)
+      {
+        d[v * n + source] = hops;
+      });
+
+    return result;
+  }
+
+}
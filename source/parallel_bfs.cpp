@@ -0,0 +1,99 @@
+/// @file parallel_bfs.cpp
+/// @brief Level-synchronous parallel breadth-first search implementation.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/graph_search.hpp>
+#include "atomic_bitvector.hpp"
+#include "frontier_expansion.hpp"
+
+#include <stdexcept>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Parents initialized by one task.
+    constexpr Scalar_size parallel_bfs_fill_block = Scalar_size(1) << 16;
+
+
+    /// Expand the levels from the start, for_each_neighbor(u, f) calls f(v) for all the neighbors v of u.
+    template <typename For_each_neighbor>
+    void run_levels(Vertex_index start_index, std::span<Vertex_index> parents, Thread_pool& pool,
+        Scalar_size vertex_count, For_each_neighbor for_each_neighbor)
+    {
+      Atomic_bitvector visited(vertex_count);
+      visited.set(start_index);
+      parents[start_index] = start_index;
+
+      expand_frontier({ start_index }, pool, [&](Vertex_index u, auto&& emit)
+        {
+          for_each_neighbor(u, [&](Vertex_index v)
+            {
+              if (visited.set(v))
+              {
+                parents[v] = u;
+                emit(v);
+              }
+            });
+        });
+    }
+
+  }
+
+
+  void parallel_breadth_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    std::span<Vertex_index> parents,
+    Thread_pool& pool
+  )
+  {
+    auto const n = graph.vertex_count();
+    if (start_index < 0 || start_index >= n)
+      throw std::out_of_range("parallel_breadth_first_search: start vertex index out of range.");
+    if (static_cast<Scalar_size>(parents.size()) < n)
+      throw std::invalid_argument("parallel_breadth_first_search: parents are less than the vertex count.");
+
+    pool.parallel_for((n + parallel_bfs_fill_block - 1) / parallel_bfs_fill_block, [&](Scalar_index block)
+      {
+        auto const first = block * parallel_bfs_fill_block;
+        std::fill(parents.begin() + first, parents.begin() + min(n, first + parallel_bfs_fill_block), npos);
+      });
+
+    if (auto const csr = csr_view(graph))
+    {
+      run_levels(start_index, parents, pool, n, [&csr](Vertex_index u, auto&& visit)
+        {
+          for (auto v: csr.neighbors(u))
+            visit(v);
+        });
+    }
+    else
+    {
+      run_levels(start_index, parents, pool, n, [&graph](Vertex_index u, auto&& visit)
+        {
+          auto neighbors = graph.iterate_neighbors(u);
+          for_each_batch(*neighbors, [&](std::span<Vertex_index> batch)
+            {
+              for (auto v: batch)
+                visit(v);
+              return true;
+            });
+        });
+    }
+  }
+
+  auto parallel_breadth_first_search(
+    Vertex_index start_index,
+    Graph_view const& graph,
+    Thread_pool& pool
+  ) -> std::vector<Vertex_index>
+  {
+    std::vector<Vertex_index> parents(graph.vertex_count());
+    parallel_breadth_first_search(start_index, graph, std::span(parents), pool);
+    return parents;
+  }
+
+}
@@ -0,0 +1,435 @@
+/// @file strongly_connected_components.cpp
+/// @brief Strongly connected components: iterative Pearce's algorithm, parallel trimming, forward-backward and coloring.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/strongly_connected_components.hpp>
+#include "atomic_bitvector.hpp"
+#include "frontier_expansion.hpp"
+#include "transposed_csr.hpp"
+
+#include <atomic>
+#include <stdexcept>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Vertices processed by one task.
+    constexpr Scalar_size scc_block = 4096;
+
+
+    /// Arcs [first, last) of v in the CSR arrays (no arcs if v is beyond them).
+    [[nodiscard]] auto arc_range(Csr_view const& csr, Vertex_index v) noexcept
+      -> std::pair<Scalar_index, Scalar_index>
+    {
+      if (v >= csr.vertex_count())
+        return { 0, 0 };
+      return { csr.offsets[v], csr.offsets[v + 1] };
+    }
+
+
+    /// Pearce's algorithm: rindex[v] is the search index of v while v is open or on the component stack,
+    /// then the component number. Component numbers are given downwards from n - 1, so they exceed all the search indices.
+    auto pearce(Csr_view const& csr, Scalar_size n)
+      -> Strong_components
+    {
+      struct Frame
+      {
+        Vertex_index vertex;
+        Scalar_index arc, arc_end;
+        bool         is_root;
+      };
+
+      std::vector<Vertex_index> rindex(n, 0);
+      std::vector<Vertex_index> component_stack;
+      std::vector<Frame>        search;
+
+      Vertex_index index     = 1;
+      Vertex_index component = n - 1;
+
+      auto const open = [&](Vertex_index v)
+        {
+          rindex[v] = index++;
+          auto const [first, last] = arc_range(csr, v);
+          search.push_back({ v, first, last, true });
+        };
+
+      for (Vertex_index start = 0; start < n; ++start)
+      {
+        if (rindex[start] != 0)
+          continue;
+
+        open(start);
+        while (!search.empty())
+        {
+          auto& frame = search.back();
+          auto const v = frame.vertex;
+          if (frame.arc != frame.arc_end)
+          {
+            auto const w = csr.targets[frame.arc++];
+            if (rindex[w] == 0)
+              open(w);
+            else if (rindex[w] < rindex[v])
+            {
+              rindex[v] = rindex[w];
+              frame.is_root = false;
+            }
+
+            continue;
+          }
+
+          auto const is_root = frame.is_root;
+          search.pop_back();
+          if (is_root)
+          {
+            --index;
+            while (!component_stack.empty() && rindex[v] <= rindex[component_stack.back()])
+            {
+              rindex[component_stack.back()] = component;
+              component_stack.pop_back();
+              --index;
+            }
+
+            rindex[v] = component--;
+          }
+          else
+          {
+            component_stack.push_back(v);
+          }
+
+          if (!search.empty() && rindex[v] < rindex[search.back().vertex])
+          {
+            rindex[search.back().vertex] = rindex[v];
+            search.back().is_root = false;
+          }
+        }
+      }
+
+      // Components finished first (sinks) get the least labels.
+      for (auto& r: rindex)
+        r = n - 1 - r;
+      return { std::move(rindex), n - 1 - component };
+    }
+
+
+    /// Raise target to value atomically.
+    /// @return true if target has been raised
+    auto fetch_max(Vertex_index& target, Vertex_index value) noexcept
+      -> bool
+    {
+      std::atomic_ref<Vertex_index> ref(target);
+      auto current = ref.load(std::memory_order_relaxed);
+      while (current < value)
+        if (ref.compare_exchange_weak(current, value, std::memory_order_relaxed))
+          return true;
+      return false;
+    }
+
+
+    /// Trimming, forward-backward from one pivot, then coloring rounds.
+    /// A vertex is marked in _done by the task that assigns its label.
+    class Parallel_scc
+    {
+    public:
+      Parallel_scc(Csr_view const& out, Csr_view const& in, Scalar_size n, Thread_pool& pool)
+        : _out(out), _in(in), _n(n), _pool(pool)
+        , _labels(n, npos), _done(n), _in_degrees(n), _out_degrees(n) {}
+
+      auto run()
+        -> Strong_components
+      {
+        trim();
+        forward_backward();
+        while (color());
+
+        return { std::move(_labels), _count.load() };
+      }
+
+    private:
+      Csr_view                  _out, _in;
+      Scalar_size               _n;
+      Thread_pool&              _pool;
+      std::vector<Vertex_index> _labels, _colors;
+      Atomic_bitvector          _done;
+      std::vector<Scalar_size>  _in_degrees, _out_degrees;
+      std::atomic<Scalar_size>  _count = 0;
+
+      [[nodiscard]] auto new_label() noexcept
+        -> Vertex_index
+      {
+        return _count.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      /// Call f(v) for all the vertices in parallel by blocks.
+      template <typename F>
+      void for_each_vertex(F&& f)
+      {
+        _pool.parallel_for((_n + scc_block - 1) / scc_block, [&](Scalar_index block)
+          {
+            auto const first = block * scc_block;
+            auto const last  = min(_n, first + scc_block);
+            for (auto v = first; v < last; ++v)
+              f(v);
+          });
+      }
+
+      /// Vertices v such that select(v) is true, in parallel by blocks.
+      template <typename Select>
+      auto collect(Select&& select)
+        -> std::vector<Vertex_index>
+      {
+        auto const blocks = (_n + scc_block - 1) / scc_block;
+        std::vector<std::vector<Vertex_index>> selected(blocks);
+        _pool.parallel_for(blocks, [&](Scalar_index block)
+          {
+            auto const first = block * scc_block;
+            auto const last  = min(_n, first + scc_block);
+            for (auto v = first; v < last; ++v)
+              if (select(v))
+                selected[block].push_back(v);
+          });
+
+        std::vector<Vertex_index> result;
+        for (auto const& part: selected)
+          result.insert(result.end(), part.begin(), part.end());
+        return result;
+      }
+
+      /// Claim a vertex for a new single-vertex component.
+      auto claim_single(Vertex_index v) noexcept
+        -> bool
+      {
+        if (!_done.set(v))
+          return false;
+        _labels[v] = new_label();
+        return true;
+      }
+
+      /// A vertex without in-arcs or out-arcs from the remaining vertices is a component by itself.
+      void trim()
+      {
+        for_each_vertex([&](Vertex_index v)
+          {
+            auto const [out_first, out_last] = arc_range(_out, v);
+            auto const [in_first, in_last]   = arc_range(_in, v);
+            _out_degrees[v] = out_last - out_first;
+            _in_degrees[v]  = in_last - in_first;
+          });
+
+        auto frontier = collect([&](Vertex_index v)
+          {
+            return (_in_degrees[v] == 0 || _out_degrees[v] == 0) && claim_single(v);
+          });
+
+        auto const decrement = [](Scalar_size& degree)
+          {
+            return std::atomic_ref<Scalar_size>(degree).fetch_sub(1, std::memory_order_relaxed) == 1;
+          };
+
+        expand_frontier(std::move(frontier), _pool, [&](Vertex_index u, auto&& emit)
+          {
+            for (auto w: arcs(_out, u))
+              if (decrement(_in_degrees[w]) && claim_single(w))
+                emit(w);
+            for (auto w: arcs(_in, u))
+              if (decrement(_out_degrees[w]) && claim_single(w))
+                emit(w);
+          });
+      }
+
+      [[nodiscard]] static auto arcs(Csr_view const& csr, Vertex_index v) noexcept
+        -> std::span<Vertex_index const>
+      {
+        auto const [first, last] = arc_range(csr, v);
+        return csr.targets.subspan(first, last - first);
+      }
+
+      /// The component of the remaining vertex with the most arcs is the intersection
+      /// of its forward and backward reachable sets, it is usually the giant one.
+      void forward_backward()
+      {
+        auto const blocks = (_n + scc_block - 1) / scc_block;
+        std::vector<std::pair<Scalar_size, Vertex_index>> best(blocks, { -1, npos });
+        _pool.parallel_for(blocks, [&](Scalar_index block)
+          {
+            auto const first = block * scc_block;
+            auto const last  = min(_n, first + scc_block);
+            for (auto v = first; v < last; ++v)
+              if (!_done.test(v))
+                best[block] = max(best[block], std::pair{ _in_degrees[v] * _out_degrees[v], v });
+          });
+
+        auto pivot = npos;
+        Scalar_size pivot_weight = -1;
+        for (auto [weight, v]: best)
+          if (pivot_weight < weight)
+          {
+            pivot_weight = weight;
+            pivot = v;
+          }
+
+        if (pivot == npos)
+          return;
+
+        Atomic_bitvector forward(_n);
+        forward.set(pivot);
+        expand_frontier({ pivot }, _pool, [&](Vertex_index u, auto&& emit)
+          {
+            for (auto w: arcs(_out, u))
+              if (!_done.test(w) && forward.set(w))
+                emit(w);
+          });
+
+        auto const label = new_label();
+        _done.set(pivot);
+        _labels[pivot] = label;
+        expand_frontier({ pivot }, _pool, [&](Vertex_index u, auto&& emit)
+          {
+            for (auto w: arcs(_in, u))
+              if (forward.test(w) && _done.set(w))
+              {
+                _labels[w] = label;
+                emit(w);
+              }
+          });
+      }
+
+      /// One coloring round: the greatest vertex index is propagated along the arcs of the remaining vertices
+      /// (a vertex is emitted once per raise of its color), then each vertex keeping its own color
+      /// collects its component by backward search within the color.
+      /// @return false if no vertex has remained
+      auto color()
+        -> bool
+      {
+        auto remaining = collect([&](Vertex_index v) { return !_done.test(v); });
+        if (remaining.empty())
+          return false;
+
+        if (_colors.empty())
+          _colors.resize(_n);
+        auto& colors = _colors;
+        _pool.parallel_for(static_cast<Scalar_size>(remaining.size()), [&](Scalar_index i)
+          {
+            colors[remaining[i]] = remaining[i];
+          });
+
+        expand_frontier(remaining, _pool, [&](Vertex_index u, auto&& emit)
+          {
+            auto const color = std::atomic_ref<Vertex_index>(colors[u]).load(std::memory_order_relaxed);
+            for (auto w: arcs(_out, u))
+              if (!_done.test(w) && fetch_max(colors[w], color))
+                emit(w);
+          });
+
+        std::vector<Vertex_index> roots;
+        for (auto v: remaining)
+          if (colors[v] == v)
+            roots.push_back(v);
+
+        _pool.parallel_for(static_cast<Scalar_size>(roots.size()), [&](Scalar_index i)
+          {
+            auto const root  = roots[i];
+            auto const label = new_label();
+            _done.set(root);
+            _labels[root] = label;
+
+            std::vector<Vertex_index> stack { root };
+            while (!stack.empty())
+            {
+              auto const u = stack.back();
+              stack.pop_back();
+              for (auto w: arcs(_in, u))
+                if (colors[w] == root && _done.set(w))
+                {
+                  _labels[w] = label;
+                  stack.push_back(w);
+                }
+            }
+          });
+
+        return true;
+      }
+    };
+
+  }
+
+
+  auto strongly_connected_components(Graph_view const& graph)
+    -> Strong_components
+  {
+    Adjacency_list_uptr converted;
+    return pearce(csr_view_or_convert(graph, converted), graph.vertex_count());
+  }
+
+  auto strongly_connected_components(Graph_view const& graph, Thread_pool& pool)
+    -> Strong_components
+  {
+    auto const n = graph.vertex_count();
+    Adjacency_list_uptr converted;
+    auto const out = csr_view_or_convert(graph, converted);
+
+    Transposed_csr transposed;
+    auto in = graph.is_directed()? csc_view(graph): out;
+    if (!in)
+    {
+      transposed = transpose(out, n);
+      in = transposed.view();
+    }
+
+    return Parallel_scc(out, in, n, pool).run();
+  }
+
+
+  auto condensation(Graph_view const& graph, Strong_components const& components, Graph_view& dag)
+    -> Scalar_size
+  {
+    auto const n     = graph.vertex_count();
+    auto const count = components.count;
+    if (static_cast<Scalar_size>(components.labels.size()) < n)
+      throw std::invalid_argument("condensation: component labels are less than the vertex count.");
+
+    Adjacency_list_uptr converted;
+    auto const csr = csr_view_or_convert(graph, converted);
+
+    // Vertices grouped by their components.
+    std::vector<Scalar_index> first(count + 1, 0);
+    for (Vertex_index v = 0; v < n; ++v)
+      ++first[components.labels[v] + 1];
+    for (Scalar_index c = 0; c < count; ++c)
+      first[c + 1] += first[c];
+
+    std::vector<Vertex_index> members(n);
+    auto placement = first;
+    for (Vertex_index v = 0; v < n; ++v)
+      members[placement[components.labels[v]]++] = v;
+
+    if (dag.vertex_count() < count)
+      dag.set_vertex_count(count);
+
+    // marks[d] == c if the arc c -> d has been connected.
+    std::vector<Vertex_index> marks(count, npos);
+    Scalar_size arcs = 0;
+    for (Vertex_index c = 0; c < count; ++c)
+    {
+      for (auto i = first[c]; i < first[c + 1]; ++i)
+      {
+        auto const [arc_first, arc_last] = arc_range(csr, members[i]);
+        for (auto a = arc_first; a < arc_last; ++a)
+        {
+          auto const d = components.labels[csr.targets[a]];
+          if (d != c && marks[d] != c)
+          {
+            marks[d] = c;
+            dag.connect(c, d);
+            ++arcs;
+          }
+        }
+      }
+    }
+
+    return arcs;
+  }
+
+}
@@ -0,0 +1,192 @@
+/// @file thread_pool.cpp
+/// @brief Thread_pool implementation over std::thread.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/thread_pool.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Set while the thread runs tasks of some pool: nested loops are run serially.
+    thread_local bool is_running_tasks = false;
+
+    auto resolve_thread_count(Scalar_size thread_count) noexcept
+      -> Scalar_size
+    {
+      if (thread_count <= 0)
+        thread_count = static_cast<Scalar_size>(std::thread::hardware_concurrency());
+      return max(thread_count, Scalar_size(1));
+    }
+
+  }
+
+
+  struct Thread_pool::State
+  {
+    std::vector<std::thread>  workers;
+
+    std::mutex                loop_mutex;  ///< serializes loops of different callers
+    std::mutex                mutex;       ///< guards the fields below up to next
+    std::condition_variable   loop_started;
+    std::condition_variable   loop_finished;
+    std::size_t               generation = 0;
+    Scalar_size               busy_workers = 0;
+    bool                      stopping = false;
+
+    Task_call                 call    = nullptr;
+    void*                     context = nullptr;
+    Scalar_size               count   = 0;
+    std::exception_ptr        error;
+
+    std::atomic<Scalar_index> next {0};
+
+    /// Take indices until they run out.
+    void work() noexcept
+    {
+      is_running_tasks = true;
+      for (Scalar_index index; (index = next.fetch_add(1, std::memory_order_relaxed)) < count;)
+      {
+        try
+        {
+          call(context, index);
+        }
+        catch (...)
+        {
+          std::lock_guard lock(mutex);
+          if (!error)
+            error = std::current_exception();
+          next.store(count, std::memory_order_relaxed);
+        }
+      }
+
+      is_running_tasks = false;
+    }
+
+    /// @param seen the generation of the last loop started before the worker
+    void worker_loop(std::size_t seen)
+    {
+      std::unique_lock lock(mutex);
+      for (;;)
+      {
+        loop_started.wait(lock, [&] { return stopping || generation != seen; });
+        if (stopping)
+          return;
+
+        seen = generation;
+        lock.unlock();
+        work();
+        lock.lock();
+
+        if (--busy_workers == 0)
+          loop_finished.notify_one();
+      }
+    }
+
+    void start(Scalar_size thread_count)
+    {
+      stopping = false;
+      for (Scalar_size i = 1; i < thread_count; ++i)
+        workers.emplace_back([this, seen = generation] { worker_loop(seen); });
+    }
+
+    void stop() noexcept
+    {
+      {
+        std::lock_guard lock(mutex);
+        stopping = true;
+      }
+
+      loop_started.notify_all();
+      for (auto& worker: workers)
+        worker.join();
+      workers.clear();
+    }
+  };
+
+
+  Thread_pool::Thread_pool(Scalar_size thread_count)
+    : _state(std::make_unique<State>())
+  {
+    _state->start(resolve_thread_count(thread_count));
+  }
+
+  Thread_pool::~Thread_pool()
+  {
+    _state->stop();
+  }
+
+  auto Thread_pool::thread_count() const noexcept
+    -> Scalar_size
+  {
+    return static_cast<Scalar_size>(_state->workers.size()) + 1;
+  }
+
+  void Thread_pool::set_thread_count(Scalar_size thread_count)
+  {
+    thread_count = resolve_thread_count(thread_count);
+    if (thread_count == this->thread_count())
+      return;
+
+    std::lock_guard loop_lock(_state->loop_mutex);
+    _state->stop();
+    _state->start(thread_count);
+  }
+
+  void Thread_pool::run(Scalar_size count, Task_call call, void* context)
+  {
+    if (count <= 0)
+      return;
+
+    auto& s = *_state;
+    if (count == 1 || s.workers.empty() || is_running_tasks)
+    {
+      for (Scalar_index index = 0; index < count; ++index)
+        call(context, index);
+      return;
+    }
+
+    std::lock_guard loop_lock(s.loop_mutex);
+    {
+      std::lock_guard lock(s.mutex);
+      s.call    = call;
+      s.context = context;
+      s.count   = count;
+      s.error   = nullptr;
+      s.next.store(0, std::memory_order_relaxed);
+      s.busy_workers = static_cast<Scalar_size>(s.workers.size());
+      ++s.generation;
+    }
+
+    s.loop_started.notify_all();
+    s.work();
+
+    std::exception_ptr error;
+    {
+      std::unique_lock lock(s.mutex);
+      s.loop_finished.wait(lock, [&] { return s.busy_workers == 0; });
+      error = std::exchange(s.error, nullptr);
+    }
+
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+
+  auto default_thread_pool()
+    -> Thread_pool&
+  {
+    static Thread_pool pool;
+    return pool;
+  }
+
+}
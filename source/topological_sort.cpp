@@ -0,0 +1,148 @@
+/// @file topological_sort.cpp
+/// @brief Parallel Kahn's topological levels and cycle search implementation.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/topological_sort.hpp>
+#include "frontier_expansion.hpp"
+#include "transposed_csr.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Vertices processed by one task.
+    constexpr Scalar_size topological_block = 4096;
+
+
+    /// Neighbors of v (none if v is beyond the CSR arrays).
+    [[nodiscard]] auto out_arcs(Csr_view const& csr, Vertex_index v) noexcept
+      -> std::span<Vertex_index const>
+    {
+      return v < csr.vertex_count()? csr.neighbors(v): std::span<Vertex_index const>{};
+    }
+
+  }
+
+
+  auto topological_levels(Graph_view const& graph, Thread_pool& pool)
+    -> Topological_levels
+  {
+    auto const n = graph.vertex_count();
+    Adjacency_list_uptr converted;
+    auto const csr = csr_view_or_convert(graph, converted);
+
+    auto const blocks = (n + topological_block - 1) / topological_block;
+    auto const for_each_block = [&](auto&& f)
+      {
+        pool.parallel_for(blocks, [&](Scalar_index block)
+          {
+            auto const first = block * topological_block;
+            f(block, first, min(n, first + topological_block));
+          });
+      };
+
+    std::vector<Scalar_size> in_degrees(n, 0);
+    for_each_block([&](Scalar_index, Vertex_index first, Vertex_index last)
+      {
+        for (auto u = first; u < last; ++u)
+          for (auto v: out_arcs(csr, u))
+            std::atomic_ref<Scalar_size>(in_degrees[v]).fetch_add(1, std::memory_order_relaxed);
+      });
+
+    std::vector<std::vector<Vertex_index>> sources(blocks);
+    for_each_block([&](Scalar_index block, Vertex_index first, Vertex_index last)
+      {
+        for (auto v = first; v < last; ++v)
+          if (in_degrees[v] == 0)
+            sources[block].push_back(v);
+      });
+
+    std::vector<Vertex_index> level_zero;
+    for (auto const& part: sources)
+      level_zero.insert(level_zero.end(), part.begin(), part.end());
+
+    Topological_levels result;
+    result.order.reserve(n);
+    result.level_starts.push_back(0);
+    expand_frontier(std::move(level_zero), pool,
+      [&](Vertex_index u, auto&& emit)
+      {
+        for (auto v: out_arcs(csr, u))
+          if (std::atomic_ref<Scalar_size>(in_degrees[v]).fetch_sub(1, std::memory_order_relaxed) == 1)
+            emit(v);
+      },
+      [&](std::span<Vertex_index const> level)
+      {
+        result.order.insert(result.order.end(), level.begin(), level.end());
+        result.level_starts.push_back(static_cast<Scalar_size>(result.order.size()));
+      });
+
+    result.unordered = n - static_cast<Scalar_size>(result.order.size());
+    return result;
+  }
+
+
+  auto find_cycle(Graph_view const& graph)
+    -> std::vector<Vertex_index>
+  {
+    auto const n = graph.vertex_count();
+    Adjacency_list_uptr converted;
+    auto const csr = csr_view_or_convert(graph, converted);
+
+    enum : std::uint8_t { unvisited, open, closed };
+    std::vector<std::uint8_t> states(n, unvisited);
+
+    struct Frame
+    {
+      Vertex_index                    vertex;
+      std::span<Vertex_index const>   arcs;
+    };
+
+    std::vector<Frame> search;
+    for (Vertex_index start = 0; start < n; ++start)
+    {
+      if (states[start] != unvisited)
+        continue;
+
+      states[start] = open;
+      search.push_back({ start, out_arcs(csr, start) });
+      while (!search.empty())
+      {
+        auto& frame = search.back();
+        if (frame.arcs.empty())
+        {
+          states[frame.vertex] = closed;
+          search.pop_back();
+          continue;
+        }
+
+        auto const w = frame.arcs.front();
+        frame.arcs = frame.arcs.subspan(1);
+        if (states[w] == unvisited)
+        {
+          states[w] = open;
+          search.push_back({ w, out_arcs(csr, w) });
+        }
+        else if (states[w] == open)
+        {
+          // The open vertices are on the search stack: w ... top, and top -> w closes the cycle.
+          auto first = search.end();
+          while ((--first)->vertex != w);
+
+          std::vector<Vertex_index> cycle;
+          for (; first != search.end(); ++first)
+            cycle.push_back(first->vertex);
+          return cycle;
+        }
+      }
+    }
+
+    return {};
+  }
+
+}
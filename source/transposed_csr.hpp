@@ -0,0 +1,61 @@
+/// @file source/transposed_csr.hpp
+/// @brief CSR arrays of the reversed arcs of a CSR view.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#ifndef OGXX_TRANSPOSED_CSR_HPP_INCLUDED
+#define OGXX_TRANSPOSED_CSR_HPP_INCLUDED
+
+#include <ogxx/adjacency_list.hpp>
+
+#include <vector>
+
+
+namespace ogxx
+{
+
+  /// @brief Owned CSR arrays, e.g. of the reversed arcs.
+  struct Transposed_csr
+  {
+    std::vector<Scalar_index> offsets;
+    std::vector<Vertex_index> targets;
+
+    [[nodiscard]] auto view() const noexcept
+      -> Csr_view
+    {
+      return { offsets, targets };
+    }
+  };
+
+  /// @brief Reverse the arcs by counting placement, the neighbors of each vertex come out sorted.
+  /// @param n the vertex count, at least csr.vertex_count()
+  [[nodiscard]] inline auto transpose(Csr_view const& csr, Scalar_size n)
+    -> Transposed_csr
+  {
+    Transposed_csr result;
+    result.offsets.assign(n + 1, 0);
+    result.targets.resize(csr.targets.size());
+    for (auto v: csr.targets)
+      ++result.offsets[v + 1];
+    for (Vertex_index v = 0; v < n; ++v)
+      result.offsets[v + 1] += result.offsets[v];
+
+    auto placement = result.offsets;
+    for (Vertex_index u = 0, csr_n = min(n, csr.vertex_count()); u < csr_n; ++u)
+      for (auto v: csr.neighbors(u))
+        result.targets[placement[v]++] = u;
+    return result;
+  }
+
+  /// @brief CSR arrays of a graph view, converted by new_adjacency_list_csr if the graph view is not CSR-based.
+  /// @param converted keeps the converted adjacency list
+  [[nodiscard]] inline auto csr_view_or_convert(Graph_view const& graph, Adjacency_list_uptr& converted)
+    -> Csr_view
+  {
+    if (auto const csr = csr_view(graph))
+      return csr;
+    converted = new_adjacency_list_csr(graph);
+    return csr_view(*converted);
+  }
+
+}
+
+#endif//OGXX_TRANSPOSED_CSR_HPP_INCLUDED
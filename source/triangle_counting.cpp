@@ -0,0 +1,222 @@
+/// @file triangle_counting.cpp
+/// @brief Triangle counting over a degree-ordered CSR implementation.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/triangle_counting.hpp>
+#include "transposed_csr.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    /// Vertices building the oriented arrays in one task.
+    constexpr Scalar_size build_block = 4096;
+
+    /// Vertices counted in one task: small, as the work per vertex varies much.
+    constexpr Scalar_size count_block = 64;
+
+    /// Gallop through the longer list if it is this many times longer than the shorter one.
+    constexpr Scalar_size galloping_ratio = 32;
+
+
+    /// Call f(v) for the distinct neighbors v != u of u in out-arcs and in-arcs, in increasing order.
+    template <typename F>
+    void for_each_undirected_neighbor(Csr_view const& out, Csr_view const& in, Vertex_index u, F&& f)
+    {
+      auto const arcs = [u](Csr_view const& csr)
+        {
+          return u < csr.vertex_count()? csr.neighbors(u): std::span<Vertex_index const>{};
+        };
+
+      auto a = arcs(out), b = arcs(in);
+      auto last = npos;
+      auto const take = [&](Vertex_index v)
+        {
+          if (v != last && v != u)
+            f(v);
+          last = v;
+        };
+
+      std::size_t i = 0, j = 0;
+      while (i < a.size() && j < b.size())
+        take(a[i] <= b[j]? a[i++]: b[j++]);
+      while (i < a.size())
+        take(a[i++]);
+      while (j < b.size())
+        take(b[j++]);
+    }
+
+
+    /// Call f(w) for the common items of two sorted lists.
+    template <typename F>
+    void intersect(std::span<Vertex_index const> a, std::span<Vertex_index const> b, F&& f)
+    {
+      if (a.size() > b.size())
+        std::swap(a, b);
+      if (a.empty())
+        return;
+
+      if (static_cast<Scalar_size>(b.size()) / galloping_ratio < static_cast<Scalar_size>(a.size()))
+      {
+        std::size_t i = 0, j = 0;
+        while (i < a.size() && j < b.size())
+        {
+          if (a[i] < b[j])
+            ++i;
+          else if (b[j] < a[i])
+            ++j;
+          else
+          {
+            f(a[i]);
+            ++i;
+            ++j;
+          }
+        }
+
+        return;
+      }
+
+      // Exponential search for each item of the short list from the current position in the long one.
+      std::size_t j = 0;
+      for (auto x: a)
+      {
+        std::size_t step = 1;
+        while (j + step < b.size() && b[j + step] < x)
+          step *= 2;
+
+        auto const first = b.begin() + j;
+        auto const last  = b.begin() + min(b.size(), j + step + 1);
+        j = static_cast<std::size_t>(std::lower_bound(first, last, x) - b.begin());
+        if (j == b.size())
+          return;
+        if (b[j] == x)
+          f(x);
+      }
+    }
+
+  }
+
+
+  auto count_triangles(Graph_view const& graph, Thread_pool& pool)
+    -> Triangle_counts
+  {
+    auto const n = graph.vertex_count();
+    Adjacency_list_uptr converted;
+    auto const out = csr_view_or_convert(graph, converted);
+
+    Transposed_csr transposed;
+    auto in = Csr_view{};
+    if (graph.is_directed())
+    {
+      transposed = transpose(out, n);
+      in = transposed.view();
+    }
+
+    auto const build_blocks = (n + build_block - 1) / build_block;
+    auto const for_each_block = [&](auto&& f)
+      {
+        pool.parallel_for(build_blocks, [&](Scalar_index block)
+          {
+            auto const first = block * build_block;
+            auto const last  = min(n, first + build_block);
+            for (auto u = first; u < last; ++u)
+              f(u);
+          });
+      };
+
+    std::vector<Scalar_size> degrees(n, 0);
+    for_each_block([&](Vertex_index u)
+      {
+        for_each_undirected_neighbor(out, in, u, [&](Vertex_index) { ++degrees[u]; });
+      });
+
+    auto const is_above = [&degrees](Vertex_index u, Vertex_index v)
+      {
+        return degrees[u] < degrees[v] || (degrees[u] == degrees[v] && u < v);
+      };
+
+    // The oriented arrays: neighbors of u with greater (degree, index), sorted by index.
+    std::vector<Scalar_index> offsets(n + 1, 0);
+    for_each_block([&](Vertex_index u)
+      {
+        for_each_undirected_neighbor(out, in, u, [&](Vertex_index v) { offsets[u + 1] += is_above(u, v); });
+      });
+    for (Vertex_index u = 0; u < n; ++u)
+      offsets[u + 1] += offsets[u];
+
+    std::vector<Vertex_index> targets(offsets[n]);
+    for_each_block([&](Vertex_index u)
+      {
+        auto position = offsets[u];
+        for_each_undirected_neighbor(out, in, u, [&](Vertex_index v)
+          {
+            if (is_above(u, v))
+              targets[position++] = v;
+          });
+      });
+
+    Csr_view const oriented { offsets, targets };
+    Triangle_counts result;
+    result.per_vertex.assign(n, 0);
+    auto const add = [&result](Vertex_index v, Scalar_size count)
+      {
+        std::atomic_ref<Scalar_size>(result.per_vertex[v]).fetch_add(count, std::memory_order_relaxed);
+      };
+
+    auto const count_blocks = (n + count_block - 1) / count_block;
+    std::vector<Scalar_size> totals(count_blocks, 0);
+    pool.parallel_for(count_blocks, [&](Scalar_index block)
+      {
+        auto const first = block * count_block;
+        auto const last  = min(n, first + count_block);
+        for (auto u = first; u < last; ++u)
+        {
+          Scalar_size at_u = 0;
+          for (auto v: oriented.neighbors(u))
+          {
+            Scalar_size at_uv = 0;
+            intersect(oriented.neighbors(u), oriented.neighbors(v), [&](Vertex_index w)
+              {
+                ++at_uv;
+                add(w, 1);
+              });
+
+            if (at_uv != 0)
+            {
+              add(v, at_uv);
+              at_u += at_uv;
+            }
+          }
+
+          if (at_u != 0)
+            add(u, at_u);
+          totals[block] += at_u;
+        }
+      });
+
+    for (auto t: totals)
+      result.total += t;
+
+    result.clustering.assign(n, 0.0);
+    Float wedges = 0;
+    for (Vertex_index v = 0; v < n; ++v)
+    {
+      auto const d = Float(degrees[v]);
+      auto const pairs = d * (d - 1) / 2;
+      if (pairs > 0)
+      {
+        result.clustering[v] = Float(result.per_vertex[v]) / pairs;
+        wedges += pairs;
+      }
+    }
+
+    result.transitivity = wedges > 0? 3 * Float(result.total) / wedges: 0.0;
+    return result;
+  }
+
+}
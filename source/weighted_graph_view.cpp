@@ -0,0 +1,335 @@
+/// @file weighted_graph_view.cpp
+/// @brief Weighted graph view implementation: a CSR adjacency list with a weight column.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include <ogxx/weighted_graph_view.hpp>
+#include <ogxx/iterator_algorithms.hpp>
+#include "adjacency_list_csr.hpp"
+#include "dense_st_matrix.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+
+namespace ogxx
+{
+
+  namespace
+  {
+
+    template <typename Weight>
+    struct Weighted_arc
+    {
+      Vertex_index from;
+      Vertex_index to;
+      Weight       weight;
+    };
+
+
+    /// Owns a CSR adjacency list and the weight column, the graph view interface is delegated to a CSR graph view.
+    template <typename Weight>
+    class Weighted_graph_view_csr final
+      : public Weighted_graph_view<Weight>
+    {
+    public:
+      Weighted_graph_view_csr(
+          std::vector<Scalar_index> offsets,
+          std::vector<Vertex_index> targets,
+          std::vector<Weight>       weights,
+          bool                      is_directed)
+        : _list(std::move(offsets), std::move(targets))
+        , _weights(std::move(weights))
+        , _view(new_graph_view_csr(_list, is_directed)) {}
+
+      [[nodiscard]] auto weighted_csr() const noexcept
+        -> Weighted_csr_view<Weight>        override
+      {
+        return { _list.csr(), _weights };
+      }
+
+
+      // Constant interface
+
+      [[nodiscard]] auto is_directed() const noexcept
+        -> bool                         override { return _view->is_directed(); }
+
+      [[nodiscard]] auto vertex_count() const noexcept
+        -> Scalar_size                  override { return _view->vertex_count(); }
+
+      [[nodiscard]] auto edge_count() const noexcept
+        -> Scalar_size                override { return _view->edge_count(); }
+
+      [[nodiscard]] auto iterate_edges() const
+        -> Vertex_pair_iterator_uptr     override { return _view->iterate_edges(); }
+
+      [[nodiscard]] auto iterate_neighbors(Vertex_index from) const
+        -> Index_iterator_handle                              override { return _view->iterate_neighbors(from); }
+
+      [[nodiscard]] auto iterate_in_neighbors(Vertex_index to) const
+        -> Index_iterator_handle                               override { return _view->iterate_in_neighbors(to); }
+
+      [[nodiscard]] auto in_degree(Vertex_index to) const
+        -> Scalar_size                               override { return _view->in_degree(to); }
+
+      [[nodiscard]] auto are_connected(Vertex_pair edge) const noexcept
+        -> bool                                          override { return _view->are_connected(edge); }
+
+
+      // Non-constant interface
+
+      void set_vertex_count(Scalar_size count) override
+      {
+        _view->set_vertex_count(count);
+      }
+
+      auto connect(Vertex_pair edge)
+        -> bool override
+      {
+        return _view->connect(edge);
+      }
+
+      auto disconnect(Vertex_pair edge)
+        -> bool override
+      {
+        return _view->disconnect(edge);
+      }
+
+    private:
+      Adjacency_list_csr  _list;
+      std::vector<Weight> _weights;
+      Graph_view_uptr     _view;
+    };
+
+
+    /// Counting placement of the arcs by their tails, then each row is sorted by heads
+    /// and repeated arcs are merged keeping the least weight.
+    template <typename Weight>
+    auto build_weighted_view(Scalar_size vertex_count, std::vector<Weighted_arc<Weight>> const& arcs, bool is_directed)
+      -> std::unique_ptr<Weighted_graph_view<Weight>>
+    {
+      std::vector<Scalar_index> offsets(vertex_count + 1);
+      for (auto const& arc: arcs)
+        ++offsets[arc.from + 1];
+
+      std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+      std::vector<std::pair<Vertex_index, Weight>> rows(offsets.back());
+      std::vector<Scalar_index> place(offsets.begin(), offsets.end() - 1);
+      for (auto const& arc: arcs)
+        rows[place[arc.from]++] = { arc.to, arc.weight };
+
+      std::vector<Vertex_index> targets;
+      std::vector<Weight>       weights;
+      targets.reserve(rows.size());
+      weights.reserve(rows.size());
+      for (Vertex_index v = 0; v < vertex_count; ++v)
+      {
+        auto const first = rows.begin() + offsets[v];
+        auto const last  = rows.begin() + offsets[v + 1];
+        std::sort(first, last);
+
+        offsets[v] = static_cast<Scalar_index>(targets.size());
+        for (auto item = first; item != last; ++item)
+        {
+          if (item != first && item[-1].first == item->first)
+            continue; // the first one is the least
+
+          targets.push_back(item->first);
+          weights.push_back(item->second);
+        }
+      }
+
+      offsets.back() = static_cast<Scalar_index>(targets.size());
+      return std::make_unique<Weighted_graph_view_csr<Weight>>(
+        std::move(offsets), std::move(targets), std::move(weights), is_directed);
+    }
+
+
+    template <typename Weight>
+    auto from_edge_list(Edge_list const& edges, std::span<Weight const> weights, bool is_directed, Scalar_size vertex_count)
+      -> std::unique_ptr<Weighted_graph_view<Weight>>
+    {
+      if (edges.size() != static_cast<Scalar_size>(weights.size()))
+        throw std::invalid_argument("new_weighted_graph_view: the weight count differs from the edge count.");
+
+      std::vector<Weighted_arc<Weight>> arcs;
+      arcs.reserve(is_directed? weights.size(): 2 * weights.size());
+
+      Scalar_index index = 0;
+      auto iter = edges.iterate();
+      for_each_batch(*iter, [&](std::span<Vertex_pair> batch)
+        {
+          for (auto [from, to]: batch)
+          {
+            if (from < 0 || to < 0)
+              throw std::invalid_argument("new_weighted_graph_view: negative vertex index.");
+
+            vertex_count = max(vertex_count, max(from, to) + 1);
+            auto const weight = weights[index++];
+            if (weight == no_path_length<Weight>)
+              continue;
+
+            arcs.push_back({ from, to, weight });
+            if (!is_directed && from != to)
+              arcs.push_back({ to, from, weight });
+          }
+
+          return true;
+        });
+
+      return build_weighted_view(vertex_count, arcs, is_directed);
+    }
+
+
+    /// Read the arcs of the graph row by row asking weight(u, v) for each arc.
+    template <typename Weight, typename Weight_of>
+    auto from_graph_view(Graph_view const& graph, Weight_of&& weight_of)
+      -> std::unique_ptr<Weighted_graph_view<Weight>>
+    {
+      auto const n = graph.vertex_count();
+      std::vector<Weighted_arc<Weight>> arcs;
+      auto const add_arc = [&](Vertex_index u, Vertex_index v)
+        {
+          if (v < 0 || n <= v)
+            return;
+
+          if (auto const weight = weight_of(u, v); weight != no_path_length<Weight>)
+            arcs.push_back({ u, v, weight });
+        };
+
+      if (auto const csr = csr_view(graph))
+      {
+        arcs.reserve(csr.targets.size());
+        for (Vertex_index u = 0; u < n; ++u)
+          for (auto v: csr.neighbors(u))
+            add_arc(u, v);
+      }
+      else
+      {
+        for (Vertex_index u = 0; u < n; ++u)
+        {
+          auto neighbors = graph.iterate_neighbors(u);
+          for_each_batch(*neighbors, [&](std::span<Vertex_index> batch)
+            {
+              for (auto v: batch)
+                add_arc(u, v);
+              return true;
+            });
+        }
+      }
+
+      return build_weighted_view(n, arcs, graph.is_directed());
+    }
+
+    template <typename ST>
+    auto from_graph_view(Graph_view const& graph, St_matrix<ST> const& weights)
+      -> std::unique_ptr<Weighted_graph_view<ST>>
+    {
+      auto const n     = graph.vertex_count();
+      auto const shape = weights.shape();
+      if (shape.rows < n || shape.cols < n)
+        throw std::invalid_argument("new_weighted_graph_view: the weight matrix is less than the vertex count.");
+
+      if (auto const dense = dynamic_cast<Dense_st_matrix<ST> const*>(&weights))
+      {
+        auto const data = dense->data();
+        return from_graph_view<ST>(graph, [data, cols = shape.cols](Vertex_index u, Vertex_index v)
+          {
+            return data[u * cols + v];
+          });
+      }
+
+      return from_graph_view<ST>(graph, [&weights](Vertex_index u, Vertex_index v)
+        {
+          return weights.get(u, v);
+        });
+    }
+
+
+    template <typename ST>
+    auto from_matrix(St_matrix<ST> const& weights, bool is_directed)
+      -> std::unique_ptr<Weighted_graph_view<ST>>
+    {
+      auto const shape = weights.shape();
+      if (shape.rows != shape.cols)
+        throw std::invalid_argument("new_weighted_graph_view: the weight matrix is not square.");
+
+      auto const n     = shape.rows;
+      auto const dense = dynamic_cast<Dense_st_matrix<ST> const*>(&weights);
+      auto const data  = dense? dense->data(): nullptr;
+
+      std::vector<Weighted_arc<ST>> arcs;
+      for (Vertex_index u = 0; u < n; ++u)
+      {
+        for (auto v = is_directed? 0: u + 1; v < n; ++v)
+        {
+          auto const weight = data? data[u * n + v]: weights.get(u, v);
+          if (u == v || weight == no_path_length<ST>)
+            continue;
+
+          arcs.push_back({ u, v, weight });
+          if (!is_directed)
+            arcs.push_back({ v, u, weight });
+        }
+      }
+
+      return build_weighted_view(n, arcs, is_directed);
+    }
+
+  }
+
+
+  auto new_weighted_graph_view(Edge_list const& edges, std::span<Int const> weights,
+      bool is_directed, Scalar_size vertex_count)
+    -> Int_weighted_graph_view_uptr
+  {
+    return from_edge_list(edges, weights, is_directed, vertex_count);
+  }
+
+  auto new_weighted_graph_view(Edge_list const& edges, std::span<Float const> weights,
+      bool is_directed, Scalar_size vertex_count)
+    -> Float_weighted_graph_view_uptr
+  {
+    return from_edge_list(edges, weights, is_directed, vertex_count);
+  }
+
+
+  auto new_weighted_graph_view(Graph_view const& graph, Int_matrix const& weights)
+    -> Int_weighted_graph_view_uptr
+  {
+    return from_graph_view(graph, weights);
+  }
+
+  auto new_weighted_graph_view(Graph_view const& graph, Float_matrix const& weights)
+    -> Float_weighted_graph_view_uptr
+  {
+    return from_graph_view(graph, weights);
+  }
+
+
+  auto new_weighted_graph_view(Graph_view const& graph, std::function<Int(Vertex_index, Vertex_index)> const& weight)
+    -> Int_weighted_graph_view_uptr
+  {
+    return from_graph_view<Int>(graph, weight);
+  }
+
+  auto new_weighted_graph_view(Graph_view const& graph, std::function<Float(Vertex_index, Vertex_index)> const& weight)
+    -> Float_weighted_graph_view_uptr
+  {
+    return from_graph_view<Float>(graph, weight);
+  }
+
+
+  auto new_weighted_graph_view(Int_matrix const& weights, bool is_directed)
+    -> Int_weighted_graph_view_uptr
+  {
+    return from_matrix(weights, is_directed);
+  }
+
+  auto new_weighted_graph_view(Float_matrix const& weights, bool is_directed)
+    -> Float_weighted_graph_view_uptr
+  {
+    return from_matrix(weights, is_directed);
+  }
+
+}
@@ -0,0 +1,123 @@
+/// @file adjacency_list_csr.cpp
+/// @brief Testing CSR adjacency list construction and its graph views.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include "testing_head.hpp"
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/edge_list.hpp>
+#include <ogxx/stl_iterator.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+
+TEST_SUITE("Adjacency_list_csr")
+{
+  TEST_CASE("create from arrows")
+  {
+    Vertex_pair input[]
+    {
+      { 0, 2 }, { 2, 1 }, { 0, 1 }, { 1, 3 }, { 0, 2 }
+    };
+
+    auto al  = new_adjacency_list_csr(new_stl_iterator(input), 5);
+    auto csr = csr_view(*al);
+    REQUIRE(bool(csr));
+    CHECK(al->get_vertex_count() == 5);
+    CHECK(al->degrees_sum() == 4);
+    CHECK(csr.degree(0) == 2);
+    CHECK(csr.neighbors(0)[0] == 1);
+    CHECK(csr.neighbors(0)[1] == 2);
+    CHECK(csr.degree(4) == 0);
+
+    auto adj = al->get(0).adjacency;
+    REQUIRE(adj != nullptr);
+    CHECK(adj->size() == 2);
+    CHECK(adj->contains(2));
+    CHECK(!adj->contains(3));
+    CHECK_THROWS_AS(adj->insert(3), std::logic_error);
+    CHECK_THROWS_AS(al->clear(), std::logic_error);
+
+    CHECK(!csr_view(*new_adjacency_list_hashtable()));
+  }
+
+  TEST_CASE("directed view")
+  {
+    auto el = new_edge_list_vector({{0, 1}, {1, 2}, {2, 0}, {2, 3}});
+    auto al = new_adjacency_list_csr(*directed::graph_view(*el));
+    auto gv = directed::graph_view(*al);
+
+    CHECK(bool(csr_view(*gv)));
+    CHECK(gv->is_directed());
+    CHECK(gv->vertex_count() == 4);
+    CHECK(gv->edge_count() == 4);
+    CHECK(gv->are_connected(2, 3));
+    CHECK(!gv->are_connected(3, 2));
+    CHECK(!gv->are_connected(7, 0));
+
+    std::vector<Vertex_index> neighbors;
+    auto it = gv->iterate_neighbors(2);
+    CHECK(it.is_in_place());
+    for (Vertex_index v; it->next(v);)
+      neighbors.push_back(v);
+    CHECK(neighbors == std::vector<Vertex_index>{0, 3});
+
+    Scalar_size edges = 0;
+    auto edge_it = gv->iterate_edges();
+    for (Vertex_pair e; edge_it->next(e); ++edges)
+      CHECK(gv->are_connected(e));
+    CHECK(edges == 4);
+
+    CHECK_THROWS_AS(gv->connect(3, 0), std::logic_error);
+  }
+
+  TEST_CASE("undirected view")
+  {
+    auto el = new_edge_list_vector({{0, 1}, {1, 2}, {2, 2}});
+    auto al = new_adjacency_list_csr(*directed::graph_view(*el));
+    auto sym = new_adjacency_list_csr(*undirected::graph_view(*al));
+    auto gv = undirected::graph_view(*sym);
+
+    CHECK(!gv->is_directed());
+    CHECK(sym->degrees_sum() == 5);
+    CHECK(gv->edge_count() == 3);
+    CHECK(gv->are_connected(1, 0));
+    CHECK(gv->are_connected(2, 2));
+
+    Scalar_size edges = 0;
+    auto edge_it = gv->iterate_edges();
+    for (Vertex_pair e; edge_it->next(e); ++edges)
+      CHECK(e.first <= e.second);
+    CHECK(edges == 3);
+  }
+
+  TEST_CASE("in-neighbors")
+  {
+    auto el = new_edge_list_vector({{0, 2}, {1, 2}, {3, 2}, {2, 0}, {1, 1}});
+    auto al = new_adjacency_list_bidirectional_csr(*el);
+    auto gv = directed::graph_view(*al);
+
+    auto csc = csc_view(*gv);
+    REQUIRE(bool(csc));
+    CHECK(csc.vertex_count() == 4);
+    CHECK(gv->in_degree(2) == 3);
+    CHECK(gv->in_degree(3) == 0);
+    CHECK(gv->in_degree(9) == 0);
+
+    std::vector<Vertex_index> in_neighbors;
+    auto it = gv->iterate_in_neighbors(2);
+    CHECK(it.is_in_place());
+    for (Vertex_index v; it->next(v);)
+      in_neighbors.push_back(v);
+    CHECK(in_neighbors == std::vector<Vertex_index>{0, 1, 3});
+
+    // The default implementation scans the edges.
+    auto el_view = directed::graph_view(*el);
+    CHECK(el_view->in_degree(2) == 3);
+    CHECK(el_view->in_degree(1) == 1);
+
+    // No CSC arrays in a plain CSR adjacency list.
+    auto plain = new_adjacency_list_csr(*el_view);
+    CHECK(!csc_view(*plain));
+    CHECK(directed::graph_view(*plain)->in_degree(0) == 1);
+  }
+}
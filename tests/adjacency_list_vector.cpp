@@ -0,0 +1,48 @@
+/// @file adjacency_list_vector.cpp
+/// @brief Testing Adjacency_list_vector in both storage modes.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include "testing_head.hpp"
+#include <ogxx/adjacency_list.hpp>
+
+
+TEST_SUITE("Adjacency_list_vector")
+{
+  TEST_CASE("connect via graph view")
+  {
+    Adjacency_list_uptr lists[]
+    {
+      new_adjacency_list_vector(),
+      new_adjacency_list_vector_arena()
+    };
+
+    for (auto& al: lists)
+    {
+      auto gv = directed::graph_view(*al);
+      gv->set_vertex_count(4);
+      CHECK(gv->connect(0, 1));
+      CHECK(gv->connect(0, 3));
+      CHECK(gv->connect(2, 0));
+      CHECK(!gv->connect(0, 1));
+      CHECK(gv->connect(5, 0)); // the list grows
+
+      CHECK(al->get_vertex_count() == 6);
+      CHECK(al->degrees_sum() == 4);
+      CHECK(gv->are_connected(0, 3));
+      CHECK(!gv->are_connected(3, 0));
+      CHECK(gv->disconnect(0, 3));
+      CHECK(!gv->are_connected(0, 3));
+
+      al->set(3, { 3, new_adjacency_hashtable().release() });
+      al->get_or_create_adjacency(3).insert(1);
+      CHECK(gv->are_connected(3, 1));
+
+      al->set_vertex_count(2);
+      CHECK(al->degrees_sum() == 1);
+
+      al->clear();
+      CHECK(al->is_empty());
+      CHECK(gv->connect(1, 0));
+      CHECK(al->degrees_sum() == 1);
+    }
+  }
+}
@@ -3,11 +3,27 @@
 
 #include "is_within_clamp_min_max.cpp"
 #include "stl_iterator_and_iterator_algorithms.cpp"
+#include "iterator_handle.cpp"
 #include "matrix_index_shape_window.cpp"
 #include "dense_st_matrix.cpp"
 #include "index_set_sortedvector.cpp"
 #include "edge_list_hashtable.cpp"
-//#include "testing_index_set_bitvector.cpp"
+#include "adjacency_list_vector.cpp"
+#include "adjacency_list_csr.cpp"
+#include "index_set_bitvector.cpp"
+#include "index_set_algebra.cpp"
+#include "thread_pool.cpp"
+#include "floyd_warshall.cpp"
+#include "johnson.cpp"
+#include "weighted_graph_view.cpp"
+#include "dijkstra.cpp"
+#include "delta_stepping.cpp"
+#include "graph_search.cpp"
+#include "multi_source_bfs.cpp"
+#include "connected_components.cpp"
+#include "strongly_connected_components.cpp"
+#include "topological_sort.cpp"
+#include "triangle_counting.cpp"
 
 #include "st_matrix_io_read.cpp"
 #include "adjacency_list_io_read.cpp"
@@ -0,0 +1,84 @@
+/// @file connected_components.cpp
+/// @brief Testing the concurrent disjoint-set structure and parallel connected components.
+#include "testing_head.hpp"
+#include <ogxx/connected_components.hpp>
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/edge_list.hpp>
+
+#include <random>
+#include <vector>
+
+
+TEST_SUITE("connected_components")
+{
+  TEST_CASE("concurrent disjoint set")
+  {
+    Concurrent_disjoint_set sets(6);
+    CHECK(sets.size() == 6);
+    CHECK(sets.unite(4, 2));
+    CHECK(sets.unite(5, 4));
+    CHECK(!sets.unite(2, 5));
+    CHECK(sets.find(5) == 2);
+    CHECK(sets.are_united(4, 5));
+    CHECK(!sets.are_united(0, 5));
+
+    sets.resize(8);
+    CHECK(sets.find(7) == 7);
+    CHECK(sets.unite(7, 5));
+    CHECK(sets.find(7) == 2);
+
+    // Chain 0 - 1 - ... - n-1 united by many tasks in a scattered order.
+    Scalar_size const n = 20000;
+    Concurrent_disjoint_set chain(n);
+    Thread_pool pool(4);
+    std::vector<Scalar_size> merges(64);
+    pool.parallel_for(64, [&](Scalar_index task)
+      {
+        for (auto i = task; i + 1 < n; i += 64)
+          merges[task] += chain.unite(i + 1, i);
+      });
+
+    Scalar_size total = 0;
+    for (auto m: merges)
+      total += m;
+    CHECK(total == n - 1);
+    CHECK(chain.find(n - 1) == 0);
+  }
+
+  TEST_CASE("labels match a serial union-find")
+  {
+    Scalar_size const n = 6000;
+    std::mt19937 rng(21);
+    std::uniform_int_distribution<Vertex_index> vertex(0, n - 1);
+    auto const el = new_edge_list_vector();
+    for (Scalar_index i = 0; i < n * 9 / 10; ++i)
+      el->put({ vertex(rng), vertex(rng) });
+    // A big component to be skipped after sampling.
+    for (Vertex_index v = 1; v < n / 2; v += 2)
+      el->put({ v, v + 2 < n / 2? v + 2: 1 });
+    el->put({ n - 1, n - 1 });
+
+    auto const directed_gv   = directed::graph_view(*el);
+    auto const directed_al   = new_adjacency_list_csr(*directed_gv);
+    auto const csr_gv        = directed::graph_view(*directed_al);
+    auto const undirected_al = new_adjacency_list_csr(*undirected::graph_view(*directed_al));
+    auto const undirected_gv = undirected::graph_view(*undirected_al);
+
+    Thread_pool pool(3);
+    for (auto graph: { directed_gv.get(), csr_gv.get(), undirected_gv.get() })
+    {
+      Concurrent_disjoint_set serial(n);
+      for (Vertex_index u = 0; u < n; ++u)
+      {
+        auto neighbors = graph->iterate_neighbors(u);
+        for (Vertex_index v; neighbors->next(v);)
+          serial.unite(u, v);
+      }
+
+      auto const labels = connected_components(*graph, pool);
+      REQUIRE(labels.size() == n);
+      for (Vertex_index v = 0; v < n; ++v)
+        CHECK(labels[v] == serial.find(v));
+    }
+  }
+}
@@ -0,0 +1,72 @@
+/// @file delta_stepping.cpp
+/// @brief Testing parallel delta-stepping.
+#include "testing_head.hpp"
+#include <ogxx/delta_stepping.hpp>
+#include <ogxx/dijkstra.hpp>
+
+#include <random>
+#include <vector>
+
+
+TEST_SUITE("delta_stepping")
+{
+  TEST_CASE("small graph")
+  {
+    auto const el = new_edge_list_vector({ {0, 1}, {0, 2}, {1, 2}, {2, 3}, {1, 3}, {4, 0} });
+    std::vector<Float> const weights { 4, 1, 0, 5, 10, 1 };
+    auto const graph = new_weighted_graph_view(*el, weights, true);
+
+    Thread_pool pool(3);
+    auto const d = delta_stepping(*graph, 0, pool);
+    CHECK(d == std::vector<Float>{ 0, 4, 1, 6, infinity });
+
+    auto rows = new_dense_st_matrix<Float>({ 2, 5 });
+    delta_stepping(*graph, 4, *rows, 1, pool, 2.0);
+    CHECK(rows->get(1, 0) == 1);
+    CHECK(rows->get(1, 3) == 7);
+
+    CHECK_THROWS_AS(delta_stepping(*graph, 4, *rows, 2, pool), std::out_of_range);
+    CHECK_THROWS_AS((void)delta_stepping(*graph, 5, pool), std::out_of_range);
+
+    std::vector<Float> const negative { 4, 1, -1, 5, 10, 1 };
+    auto const bad = new_weighted_graph_view(*el, negative, true);
+    CHECK_THROWS_AS((void)delta_stepping(*bad, 0, pool), std::invalid_argument);
+  }
+
+  TEST_CASE("matches Dijkstra on random graphs")
+  {
+    Scalar_size const n = 3000;
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<Vertex_index> vertex(0, n - 1);
+    std::uniform_int_distribution<int> weight(0, 1000);
+
+    auto const el = new_edge_list_vector();
+    std::vector<Int>   iw;
+    std::vector<Float> fw;
+    for (Scalar_index i = 0; i < 5 * n; ++i)
+    {
+      el->put({ vertex(rng), vertex(rng) });
+      iw.push_back(weight(rng));
+      fw.push_back(iw.back() * 0.25);
+    }
+
+    auto const igraph = new_weighted_graph_view(*el, iw, false);
+    auto const fgraph = new_weighted_graph_view(*el, fw, true);
+
+    Thread_pool pool(4);
+    for (Vertex_index source: { 0, 17, 2999 })
+    {
+      auto const expected  = dijkstra(*igraph, source);
+      auto const fexpected = dijkstra(*fgraph, source);
+      for (Int delta: { 0, 1, 50, 100000 })
+        CHECK(delta_stepping(*igraph, source, pool, delta) == expected);
+      for (Float delta: { 0.0, 0.5, 20.0 })
+        CHECK(delta_stepping(*fgraph, source, pool, delta) == fexpected);
+
+      std::vector<Int> flat(n + 1, -1);
+      delta_stepping(*igraph, source, std::span(flat), pool);
+      CHECK(std::equal(expected.begin(), expected.end(), flat.begin()));
+      CHECK(flat.back() == -1);
+    }
+  }
+}
@@ -0,0 +1,106 @@
+/// @file dijkstra.cpp
+/// @brief Testing Dijkstra's algorithm.
+#include "testing_head.hpp"
+#include <ogxx/dijkstra.hpp>
+#include <ogxx/floyd_warshall.hpp>
+
+#include <random>
+#include <vector>
+
+
+TEST_SUITE("Dijkstra")
+{
+  TEST_CASE("paths and early exit")
+  {
+    auto const el = new_edge_list_vector({ {0, 1}, {0, 2}, {1, 2}, {2, 3}, {1, 3}, {4, 0} });
+    std::vector<Int> const weights { 4, 1, 1, 5, 10, 1 };
+    auto const graph = new_weighted_graph_view(*el, weights, true);
+
+    for (auto heap: { Dijkstra_heap::d_ary, Dijkstra_heap::radix })
+    {
+      Dijkstra_workspace<Int> workspace(heap);
+      CHECK(workspace.heap() == heap);
+
+      CHECK(workspace.run(*graph, 0) == int_infinity);
+      CHECK(workspace.distance(0) == 0);
+      CHECK(workspace.distance(1) == 4);
+      CHECK(workspace.distance(2) == 1);
+      CHECK(workspace.distance(3) == 6);
+      CHECK(workspace.distance(4) == int_infinity);
+      CHECK(workspace.parent(3) == 2);
+      CHECK(workspace.parent(0) == npos);
+
+      std::vector<Vertex_index> path;
+      CHECK(workspace.path(3, path));
+      CHECK(path == std::vector<Vertex_index>{ 0, 2, 3 });
+      CHECK(!workspace.path(4, path));
+      CHECK(path.empty());
+
+      // Stops before settling vertex 3, the previous run leaves nothing behind.
+      CHECK(workspace.run(*graph, 0, 2) == 1);
+      CHECK(workspace.distance(3) == int_infinity);
+      CHECK(workspace.run(*graph, 4, 3) == 7);
+      CHECK(workspace.run(*graph, 3, 0) == int_infinity);
+
+      CHECK_THROWS_AS((void)workspace.run(*graph, 5), std::out_of_range);
+    }
+
+    CHECK(Dijkstra_workspace<Int>().heap() == Dijkstra_heap::radix);
+    CHECK(Dijkstra_workspace<Float>().heap() == Dijkstra_heap::d_ary);
+    CHECK_THROWS_AS(Dijkstra_workspace<Float>(Dijkstra_heap::radix), std::invalid_argument);
+
+    std::vector<Int> const negative { 4, 1, -1, 5, 10, 1 };
+    auto const bad = new_weighted_graph_view(*el, negative, true);
+    CHECK_THROWS_AS((void)shortest_path_length(*bad, 0, 3), std::invalid_argument);
+  }
+
+  TEST_CASE("matches Floyd-Warshall on random graphs")
+  {
+    Scalar_size const n = 200;
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> weight(0, 100), vertex(0, n - 1);
+
+    auto lengths = new_dense_st_matrix<Int>({ n, n });
+    lengths->fill(int_infinity);
+    auto flengths = new_dense_st_matrix<Float>({ n, n });
+    flengths->fill(infinity);
+    for (Vertex_index v = 0; v < n; ++v)
+    {
+      lengths->set(v, v, 0);
+      flengths->set(v, v, 0);
+    }
+
+    for (int i = 0; i < 4 * n; ++i)
+    {
+      auto const u = vertex(rng), v = vertex(rng);
+      auto const w = weight(rng);
+      if (u != v)
+      {
+        lengths->set(u, v, w);
+        flengths->set(u, v, w * 0.5);
+      }
+    }
+
+    auto const graph  = new_weighted_graph_view(*lengths);
+    auto const fgraph = new_weighted_graph_view(*flengths);
+    auto const d  = floyd_warshall_only_matrix(*lengths);
+    auto const fd = floyd_warshall_only_matrix(*flengths);
+
+    Dijkstra_workspace<Int> d_ary(Dijkstra_heap::d_ary), radix(Dijkstra_heap::radix);
+    for (Vertex_index s = 0; s < n; ++s)
+    {
+      auto const all = dijkstra(*graph, s);
+      auto const fall = dijkstra(*fgraph, s);
+      for (Vertex_index t = 0; t < n; ++t)
+      {
+        CHECK(all[t] == d->get(s, t));
+        CHECK(fall[t] == fd->get(s, t));
+      }
+
+      auto const t = (s * 7 + 3) % n;
+      CHECK(d_ary.run(*graph, s, t) == d->get(s, t));
+      CHECK(radix.run(*graph, s, t) == d->get(s, t));
+      CHECK(shortest_path_length(*fgraph, s, t) == fd->get(s, t));
+    }
+  }
+}
@@ -27,4 +27,45 @@ TEST_SUITE("Edge_list_hashtable")
 
     CHECK(!set->contains(Vertex_pair{3, 0}));
   }
+
+  TEST_CASE("insert, find, erase, take many")
+  {
+    auto el  = new_edge_list_hashtable();
+    auto set = dynamic_cast<St_set<Vertex_pair>*>(el.get());
+    REQUIRE(set != nullptr);
+
+    Scalar_size const n = 5000;
+    for (Vertex_index i = 0; i < n; ++i)
+      CHECK(set->insert({ i, i * 7 % 13 }));
+    CHECK(!set->insert({ 0, 0 }));
+    CHECK(el->size() == n);
+    CHECK(el->max_vertex_index() == n - 1);
+
+    // Slot indices are distinct and stable while nothing is inserted.
+    auto const slot = el->find({ 42, 42 * 7 % 13 });
+    CHECK(slot != npos);
+    CHECK(el->find({ 42, 100 }) == npos);
+
+    for (Vertex_index i = 0; i < n; i += 2)
+      CHECK(set->erase({ i, i * 7 % 13 }));
+    CHECK(el->size() == n / 2);
+    CHECK(el->find({ 43, 43 * 7 % 13 }) != npos);
+    CHECK(el->find({ 42, 42 * 7 % 13 }) == npos);
+
+    Scalar_size iterated = 0;
+    auto it = el->iterate();
+    for (Vertex_pair vp; it->next(vp); ++iterated)
+      CHECK(vp.first % 2 == 1);
+    CHECK(iterated == n / 2);
+
+    Scalar_size taken = 0;
+    while (!el->is_empty())
+    {
+      auto const vp = el->take();
+      CHECK(!set->contains(vp));
+      ++taken;
+    }
+    CHECK(taken == n / 2);
+    CHECK(el->take().first == npos);
+  }
 }
@@ -0,0 +1,277 @@
+/// @file floyd_warshall.cpp
+/// @brief Testing Floyd-Warshall algorithm.
+#include "testing_head.hpp"
+#include <ogxx/floyd_warshall.hpp>
+#include "../source/min_plus.hpp"
+
+#include <random>
+#include <vector>
+
+
+namespace
+{
+
+  /// Textbook triple loop to compare with.
+  template <typename ST>
+  auto floyd_warshall_reference(std::vector<ST> d, Scalar_size n)
+    -> std::vector<ST>
+  {
+    for (Scalar_index k = 0; k < n; ++k)
+      for (Scalar_index i = 0; i < n; ++i)
+        for (Scalar_index j = 0; j < n; ++j)
+          d[i * n + j] = min(d[i * n + j], d[i * n + k] + d[k * n + j]);
+    return d;
+  }
+
+  /// Random sparse graph (about 5% of arcs) with "no arc" as a big weight.
+  template <typename ST>
+  void check_random_graph(Scalar_size n, unsigned seed)
+  {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> weight(1, 100), arc(0, 19);
+
+    auto matrix = new_dense_st_matrix<ST>({ n, n });
+    std::vector<ST> items(n * n);
+    for (Scalar_index i = 0; i < n; ++i)
+      for (Scalar_index j = 0; j < n; ++j)
+      {
+        ST const value = i == j? ST(0): arc(rng) == 0? ST(weight(rng)): ST(1'000'000);
+        matrix->set(i, j, value);
+        items[i * n + j] = value;
+      }
+
+    auto const result   = floyd_warshall_only_matrix(*matrix);
+    auto const expected = floyd_warshall_reference(items, n);
+
+    REQUIRE(result->shape() == Matrix_shape{ n, n });
+    Scalar_size mismatches = 0;
+    for (Scalar_index i = 0; i < n; ++i)
+      for (Scalar_index j = 0; j < n; ++j)
+        mismatches += result->get(i, j) != expected[i * n + j];
+    CHECK(mismatches == 0);
+
+    Thread_pool pool(4);
+    auto const parallel = floyd_warshall_only_matrix(*matrix, pool);
+    mismatches = 0;
+    for (Scalar_index i = 0; i < n; ++i)
+      for (Scalar_index j = 0; j < n; ++j)
+        mismatches += parallel->get(i, j) != result->get(i, j);
+    CHECK(mismatches == 0);
+  }
+
+}
+
+
+TEST_SUITE("Floyd-Warshall")
+{
+  TEST_CASE("small graph")
+  {
+    Int const inf = 1'000'000;
+    Int const arcs[4][4]
+    {
+      {   0,   3, inf,   7 },
+      {   8,   0,   2, inf },
+      {   5, inf,   0,   1 },
+      {   2, inf, inf,   0 },
+    };
+
+    auto matrix = new_dense_st_matrix<Int>({ 4, 4 });
+    for (Scalar_index i = 0; i < 4; ++i)
+      for (Scalar_index j = 0; j < 4; ++j)
+        matrix->set(i, j, arcs[i][j]);
+
+    auto const result = floyd_warshall_only_matrix(*matrix);
+    CHECK(result->get(0, 2) == 5);
+    CHECK(result->get(1, 0) == 5);
+    CHECK(result->get(2, 1) == 6);
+    CHECK(result->get(3, 2) == 7);
+    CHECK(matrix->get(0, 2) == inf);
+  }
+
+  TEST_CASE("blocked matches textbook")
+  {
+    // Sizes around and across tile boundaries.
+    for (Scalar_size n: { 1, 63, 64, 65, 150 })
+    {
+      check_random_graph<Int>(n, static_cast<unsigned>(n));
+      check_random_graph<Float>(n, static_cast<unsigned>(n) + 1);
+    }
+  }
+
+  TEST_CASE("min-plus kernels agree with scalar saturating arithmetic")
+  {
+    Scalar_size const n = 37; // not a multiple of any vector width
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<Int> small(-1000, 1000), kind(0, 5);
+
+    std::vector<Int>   ints(n * n);
+    std::vector<Float> floats(n * n);
+    for (Scalar_index i = 0; i < n * n; ++i)
+    {
+      switch (kind(rng))
+      {
+      case 0:  ints[i] = int_infinity;                                break;
+      case 1:  ints[i] = int_infinity - 1 - small(rng) % 10;          break;
+      case 2:  ints[i] = std::numeric_limits<Int>::min() + 5 + small(rng) % 5; break;
+      default: ints[i] = small(rng);                                  break;
+      }
+
+      floats[i] = ints[i] == int_infinity? infinity: Float(ints[i]) / 8;
+    }
+
+    auto const expected_ints   = [&] { auto d = ints;   min_plus_tile(d.data(), n, 0, n, 0, n, 0, n, Min_plus_isa::scalar); return d; }();
+    auto const expected_floats = [&] { auto d = floats; min_plus_tile(d.data(), n, 0, n, 0, n, 0, n, Min_plus_isa::scalar); return d; }();
+
+    // The scalar kernel itself is the textbook loop with saturating_add.
+    auto textbook = ints;
+    for (Scalar_index k = 0; k < n; ++k)
+      for (Scalar_index i = 0; i < n; ++i)
+        if (auto const through = textbook[i * n + k]; through != int_infinity)
+          for (Scalar_index j = 0; j < n; ++j)
+            textbook[i * n + j] = min(textbook[i * n + j], saturating_add(through, textbook[k * n + j]));
+    CHECK(textbook == expected_ints);
+
+    for (auto isa: { Min_plus_isa::avx2, Min_plus_isa::avx512 })
+    {
+      if (!is_supported(isa))
+        continue;
+
+      auto d = ints;
+      min_plus_tile(d.data(), n, 0, n, 0, n, 0, n, isa);
+      CHECK(d == expected_ints);
+
+      auto f = floats;
+      min_plus_tile(f.data(), n, 0, n, 0, n, 0, n, isa);
+      CHECK(f == expected_floats);
+
+      // A tile overlapping the row and the column of k.
+      auto part = ints, part_expected = ints;
+      min_plus_tile(part.data(), n, 3, 30, 5, 36, 4, 20, isa);
+      min_plus_tile(part_expected.data(), n, 3, 30, 5, 36, 4, 20, Min_plus_isa::scalar);
+      CHECK(part == part_expected);
+
+      // Next hops: start from the column index and compare with the scalar kernel.
+      std::vector<Int> next(n * n), next_expected(n * n);
+      for (Scalar_index i = 0; i < n * n; ++i)
+        next[i] = next_expected[i] = Int(i % n);
+
+      auto fd = floats, fd_expected = floats;
+      min_plus_tile(fd.data(), next.data(), n, 0, n, 0, n, 0, n, isa);
+      min_plus_tile(fd_expected.data(), next_expected.data(), n, 0, n, 0, n, 0, n, Min_plus_isa::scalar);
+      CHECK(fd == expected_floats);
+      CHECK(next == next_expected);
+
+      auto id = ints, id_expected = ints;
+      min_plus_tile(id.data(), next.data(), n, 0, n, 0, n, 0, n, isa);
+      min_plus_tile(id_expected.data(), next_expected.data(), n, 0, n, 0, n, 0, n, Min_plus_isa::scalar);
+      CHECK(id == expected_ints);
+      CHECK(next == next_expected);
+    }
+  }
+
+  TEST_CASE("int_infinity means no edge")
+  {
+    auto matrix = new_dense_st_matrix<Int>({ 3, 3 });
+    matrix->fill(int_infinity);
+    matrix->set(0, 0, 0);
+    matrix->set(1, 1, 0);
+    matrix->set(2, 2, 0);
+    matrix->set(0, 1, int_infinity - 1);
+    matrix->set(1, 2, 5);
+
+    auto const result = floyd_warshall_only_matrix(*matrix);
+    CHECK(result->get(0, 2) == int_infinity);
+    CHECK(result->get(2, 0) == int_infinity);
+    CHECK(result->get(0, 1) == int_infinity - 1);
+    CHECK(result->get(1, 2) == 5);
+  }
+
+  TEST_CASE("paths")
+  {
+    Int const inf = int_infinity;
+    Int const arcs[5][5]
+    {
+      {   0,   3, inf,   7, inf },
+      {   8,   0,   2, inf, inf },
+      {   5, inf,   0,   1, inf },
+      {   2, inf, inf,   0, inf },
+      { inf, inf, inf, inf,   0 },
+    };
+
+    auto matrix = new_dense_st_matrix<Int>({ 5, 5 });
+    for (Scalar_index i = 0; i < 5; ++i)
+      for (Scalar_index j = 0; j < 5; ++j)
+        matrix->set(i, j, arcs[i][j]);
+
+    auto const path_of = [](Int_matrix const& next_hops, Vertex_index from, Vertex_index to)
+      {
+        std::vector<Vertex_index> result;
+        Path_iterator path(next_hops, from, to);
+        for (Vertex_index v; path.next(v);)
+          result.push_back(v);
+        return result;
+      };
+
+    auto const paths = floyd_warshall(*matrix);
+    CHECK(paths.distances->get(0, 3) == 6);
+    CHECK(path_of(*paths.next_hops, 0, 3) == std::vector<Vertex_index>{ 0, 1, 2, 3 });
+    CHECK(path_of(*paths.next_hops, 1, 0) == std::vector<Vertex_index>{ 1, 2, 3, 0 });
+    CHECK(path_of(*paths.next_hops, 2, 2) == std::vector<Vertex_index>{ 2 });
+    CHECK(path_of(*paths.next_hops, 0, 4).empty());
+    CHECK(path_of(*paths.next_hops, 0, 5).empty());
+    CHECK(paths.next_hops->get(4, 0) == npos);
+  }
+
+  TEST_CASE("paths are shortest on random graphs")
+  {
+    Scalar_size const n = 140;
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> weight(1, 100), arc(0, 29);
+
+    auto matrix = new_dense_st_matrix<Float>({ n, n });
+    matrix->fill(infinity);
+    for (Scalar_index i = 0; i < n; ++i)
+      for (Scalar_index j = 0; j < n; ++j)
+        if (i == j)
+          matrix->set(i, j, 0.);
+        else if (arc(rng) == 0)
+          matrix->set(i, j, Float(weight(rng)) / 4);
+
+    Thread_pool pool(3);
+    auto const serial   = floyd_warshall(*matrix);
+    auto const parallel = floyd_warshall(*matrix, pool);
+    auto const only     = floyd_warshall_only_matrix(*matrix);
+
+    Scalar_size wrong = 0;
+    for (Vertex_index from = 0; from < n; ++from)
+    {
+      for (Vertex_index to = 0; to < n; ++to)
+      {
+        auto const d = serial.distances->get(from, to);
+        wrong += d != only->get(from, to);
+        wrong += serial.next_hops->get(from, to) != parallel.next_hops->get(from, to);
+
+        // The sum of the arcs along the path is the distance.
+        Path_iterator path(*serial.next_hops, from, to);
+        Float length = 0;
+        Vertex_index prev = npos, v;
+        while (path.next(v))
+        {
+          if (prev != npos)
+            length += matrix->get(prev, v);
+          prev = v;
+        }
+
+        wrong += prev == npos? d != infinity: (prev != to || length != d);
+      }
+    }
+
+    CHECK(wrong == 0);
+  }
+
+  TEST_CASE("not square")
+  {
+    auto matrix = new_dense_st_matrix<Float>({ 2, 3 });
+    CHECK_THROWS_AS((void)floyd_warshall_only_matrix(*matrix), std::invalid_argument);
+  }
+}
@@ -0,0 +1,257 @@
+/// @file graph_search.cpp
+/// @brief Testing graph search functions and controllers.
+#include "testing_head.hpp"
+#include <ogxx/graph_search.hpp>
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/edge_list.hpp>
+#include <ogxx/stl_iterator.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+
+  struct Search_record
+  {
+    std::vector<ogxx::Vertex_index> discovered, parents, finished;
+    ogxx::Scalar_size               examined   = 0;
+    ogxx::Scalar_size               stop_after = -1;
+  };
+
+  /// Records all the events (the search functions taking a controller pointer own it).
+  class Recording_controller
+    : public ogxx::Graph_search_controller
+  {
+  public:
+    explicit Recording_controller(Search_record& record) noexcept
+      : _record(record) {}
+
+    auto discover_vertex(ogxx::Vertex_index vertex, ogxx::Vertex_index parent)
+      -> bool override
+    {
+      _record.discovered.push_back(vertex);
+      _record.parents.push_back(parent);
+      return static_cast<ogxx::Scalar_size>(_record.discovered.size()) != _record.stop_after;
+    }
+
+    auto examine_edge(ogxx::Vertex_index, ogxx::Vertex_index)
+      -> bool override
+    {
+      ++_record.examined;
+      return true;
+    }
+
+    auto finish_vertex(ogxx::Vertex_index vertex)
+      -> bool override
+    {
+      _record.finished.push_back(vertex);
+      return true;
+    }
+
+  private:
+    Search_record& _record;
+  };
+
+  /// Discover events only, no virtual functions.
+  struct Discover_counter
+  {
+    ogxx::Scalar_size count = 0;
+
+    auto discover_vertex(ogxx::Vertex_index, ogxx::Vertex_index)
+      -> bool
+    {
+      ++count;
+      return true;
+    }
+  };
+
+  /// Computes BFS levels out of the parents.
+  struct Level_recorder
+  {
+    std::vector<ogxx::Scalar_index> levels;
+
+    auto discover_vertex(ogxx::Vertex_index vertex, ogxx::Vertex_index parent)
+      -> bool
+    {
+      levels[vertex] = parent == ogxx::npos? 0: levels[parent] + 1;
+      return true;
+    }
+  };
+
+}
+
+
+TEST_SUITE("graph_search")
+{
+  // 0 -> 1, 0 -> 2, 1 -> 3, 2 -> 3, 3 -> 4, 5 -> 0
+  auto make_edges()
+  {
+    return new_edge_list_vector({ {0, 1}, {0, 2}, {1, 3}, {2, 3}, {3, 4}, {5, 0} });
+  }
+
+  TEST_CASE("breadth-first and depth-first orders")
+  {
+    auto const el  = make_edges();
+    auto const egv = directed::graph_view(*el);
+    auto const al  = new_adjacency_list_csr(*egv);
+    auto const gv  = directed::graph_view(*al);
+
+    for (auto graph: { egv.get(), gv.get() })
+    {
+      Search_record b;
+      CHECK(!breadth_first_search(0, *graph, std::make_unique<Recording_controller>(b)));
+      CHECK(b.discovered == std::vector<Vertex_index>{ 0, 1, 2, 3, 4 });
+      CHECK(b.parents    == std::vector<Vertex_index>{ npos, 0, 0, 1, 3 });
+      CHECK(b.finished   == std::vector<Vertex_index>{ 0, 1, 2, 3, 4 });
+      CHECK(b.examined   == 5);
+
+      Search_record d;
+      CHECK(!depth_first_search(0, *graph, std::make_unique<Recording_controller>(d)));
+      CHECK(d.discovered == std::vector<Vertex_index>{ 0, 1, 2, 3, 4 });
+      CHECK(d.finished   == std::vector<Vertex_index>{ 0, 2, 3, 4, 1 });
+
+      Search_record r;
+      CHECK(!random_first_search(0, *graph, std::make_unique<Recording_controller>(r)));
+      std::sort(r.finished.begin(), r.finished.end());
+      CHECK(r.finished == std::vector<Vertex_index>{ 0, 1, 2, 3, 4 });
+    }
+  }
+
+  TEST_CASE("storages, early stop and template controllers")
+  {
+    auto const el = make_edges();
+    auto const gv = directed::graph_view(*el);
+
+    // Vertex 1 is prohibited.
+    auto visited = new_index_set_bitvector();
+    visited->insert(1);
+    Search_record c;
+    CHECK(!breadth_first_search(5, *gv, std::move(visited), std::make_unique<Recording_controller>(c)));
+    CHECK(c.discovered == std::vector<Vertex_index>{ 5, 0, 2, 3, 4 });
+
+    Search_record s;
+    s.stop_after = 3;
+    CHECK(graph_search(5, *gv, new_index_queue(), std::make_unique<Recording_controller>(s)));
+    CHECK(s.discovered == std::vector<Vertex_index>{ 5, 0, 1 });
+
+    CHECK(!depth_first_search(4, *gv, nullptr));
+
+    Discover_counter counter;
+    CHECK(!breadth_first_search(5, *gv, counter));
+    CHECK(counter.count == 6);
+
+    Search_record record;
+    record.stop_after = 2;
+    Recording_controller direct(record);
+    CHECK(depth_first_search(0, *gv, direct));
+    CHECK(record.discovered.size() == 2);
+    CHECK_THROWS_AS((void)breadth_first_search(6, *gv, counter), std::out_of_range);
+  }
+
+  TEST_CASE("direction-optimizing breadth-first search")
+  {
+    Scalar_size const n = 5000;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<Vertex_index> vertex(0, n - 1);
+    auto const el = new_edge_list_vector();
+    for (Scalar_index i = 0; i < 4 * n; ++i)
+      el->put({ vertex(rng), vertex(rng) });
+
+    auto const directed_al    = new_adjacency_list_bidirectional_csr(*directed::graph_view(*el));
+    auto const undirected_al  = new_adjacency_list_csr(*undirected::graph_view(*new_adjacency_list_csr(*directed::graph_view(*el))));
+    auto const directed_gv    = directed::graph_view(*directed_al);
+    auto const undirected_gv  = undirected::graph_view(*undirected_al);
+
+    for (auto graph: { directed_gv.get(), undirected_gv.get() })
+    {
+      for (Vertex_index start: { 0, 1234 })
+      {
+        Level_recorder top_down { std::vector<Scalar_index>(n, npos) };
+        Level_recorder optimizing { std::vector<Scalar_index>(n, npos) };
+        CHECK(!breadth_first_search(start, *graph, top_down, Bfs_mode::top_down));
+        CHECK(!breadth_first_search(start, *graph, optimizing, Bfs_mode::direction_optimizing));
+        CHECK(optimizing.levels == top_down.levels);
+      }
+    }
+
+    Search_record s;
+    s.stop_after = 100;
+    CHECK(breadth_first_search(0, *undirected_gv, std::make_unique<Recording_controller>(s), Bfs_mode::direction_optimizing));
+    CHECK(s.discovered.size() == 100);
+    for (Scalar_index i = 1; i < 100; ++i)
+      CHECK(undirected_gv->are_connected(s.parents[i], s.discovered[i]));
+  }
+
+  TEST_CASE("parallel breadth-first search")
+  {
+    Scalar_size const n = 5000;
+    std::mt19937 rng(13);
+    std::uniform_int_distribution<Vertex_index> vertex(0, n - 1);
+    auto const el = new_edge_list_vector();
+    for (Scalar_index i = 0; i < 3 * n; ++i)
+      el->put({ vertex(rng), vertex(rng) });
+
+    auto const edge_gv = directed::graph_view(*el);
+    auto const al      = new_adjacency_list_csr(*edge_gv);
+    auto const csr_gv  = directed::graph_view(*al);
+
+    Thread_pool pool(4);
+    for (auto graph: { csr_gv.get(), edge_gv.get() })
+    {
+      Level_recorder expected { std::vector<Scalar_index>(n, npos) };
+      CHECK(!breadth_first_search(3, *graph, expected));
+
+      auto const parents = parallel_breadth_first_search(3, *graph, pool);
+      REQUIRE(parents.size() == n);
+      CHECK(parents[3] == 3);
+
+      Scalar_size reached = 0;
+      for (Vertex_index v = 0; v < n; ++v)
+      {
+        if (expected.levels[v] == npos)
+        {
+          CHECK(parents[v] == npos);
+          continue;
+        }
+
+        ++reached;
+        if (v != 3)
+        {
+          CHECK(graph->are_connected(parents[v], v));
+          CHECK(expected.levels[parents[v]] + 1 == expected.levels[v]);
+        }
+      }
+
+      auto const tree_el = new_edge_list_vector();
+      auto const tree    = directed::graph_view(*tree_el);
+      tree->set_vertex_count(n);
+      CHECK(pred_list_to_tree(new_stl_iterator(parents), *tree) == n - reached + 1);
+      CHECK(tree_el->size() == reached - 1);
+    }
+
+    std::vector<Vertex_index> small(n - 1);
+    CHECK_THROWS_AS(parallel_breadth_first_search(0, *csr_gv, std::span(small), pool), std::invalid_argument);
+    CHECK_THROWS_AS((void)parallel_breadth_first_search(n, *csr_gv, pool), std::out_of_range);
+  }
+
+  TEST_CASE("stack and queue bags")
+  {
+    auto stack = new_index_stack();
+    auto queue = new_index_queue();
+    for (Scalar_index i = 1; i <= 3; ++i)
+    {
+      stack->put(i);
+      queue->put(i);
+    }
+
+    CHECK(stack->size() == 3);
+    CHECK(stack->take() == 3);
+    CHECK(queue->take() == 1);
+    queue->clear();
+    CHECK(queue->is_empty());
+    CHECK_THROWS_AS((void)queue->take(), std::runtime_error);
+  }
+}
@@ -0,0 +1,96 @@
+/// @file index_set_algebra.cpp
+/// @brief Testing bulk set algebra over Index_set implementations.
+#include "testing_head.hpp"
+#include <ogxx/st_set.hpp>
+#include <ogxx/stl_iterator.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+
+namespace
+{
+
+  auto items_of(Index_set const& set)
+    -> std::vector<Scalar_index>
+  {
+    std::vector<Scalar_index> result;
+    auto it = dynamic_cast<Iterable<Scalar_index> const&>(set).iterate();
+    for (Scalar_index item; it->next(item);)
+      result.push_back(item);
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  using Set_factory = auto (*)(Index_iterator_uptr) -> Index_set_uptr;
+
+  Set_factory const set_factories[]
+  {
+    new_index_set_sortedvector,
+    new_index_set_bitvector,
+    new_index_set_hashtable,
+  };
+
+}
+
+
+TEST_SUITE("Index_set algebra")
+{
+  TEST_CASE("all implementation pairs")
+  {
+    std::vector<Scalar_index> const a { 0, 3, 5, 64, 65, 127, 128, 300, 1000 };
+    std::vector<Scalar_index> const b { 1, 3, 64, 127, 129, 300, 301 };
+
+    std::vector<Scalar_index> both, either, only_a;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(both));
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(either));
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(only_a));
+
+    for (auto make_a: set_factories)
+    {
+      for (auto make_b: set_factories)
+      {
+        auto const sa = make_a(new_stl_iterator(a));
+        auto const sb = make_b(new_stl_iterator(b));
+
+        CHECK(intersection_count(*sa, *sb) == static_cast<Scalar_size>(both.size()));
+        CHECK(items_of(*set_intersection(*sa, *sb)) == both);
+        CHECK(items_of(*set_union(*sa, *sb)) == either);
+        CHECK(items_of(*set_difference(*sa, *sb)) == only_a);
+
+        auto target = make_a(new_stl_iterator(a));
+        CHECK(insert_all(*target, *sb) == static_cast<Scalar_size>(either.size() - a.size()));
+        CHECK(items_of(*target) == either);
+      }
+    }
+  }
+
+  TEST_CASE("galloping over sorted vectors")
+  {
+    std::vector<Scalar_index> large, small { -5, 7, 500, 9996, 20001 };
+    for (Scalar_index i = 0; i < 10000; i += 7)
+      large.push_back(i);
+
+    auto const sl = new_index_set_sortedvector(new_stl_iterator(large));
+    auto const ss = new_index_set_sortedvector(new_stl_iterator(small));
+
+    CHECK(intersection_count(*sl, *ss) == 2);
+    CHECK(intersection_count(*ss, *sl) == 2);
+    CHECK(items_of(*set_intersection(*ss, *sl)) == std::vector<Scalar_index>{ 7, 9996 });
+    CHECK(set_difference(*ss, *sl)->contains(20001));
+    CHECK(!set_difference(*ss, *sl)->contains(7));
+  }
+
+  TEST_CASE("empty sets")
+  {
+    auto const empty = new_index_set_bitvector();
+    std::vector<Scalar_index> const a { 1, 2, 3 };
+    auto const sa = new_index_set_sortedvector(new_stl_iterator(a));
+
+    CHECK(intersection_count(*empty, *sa) == 0);
+    CHECK(items_of(*set_intersection(*empty, *sa)).empty());
+    CHECK(items_of(*set_union(*empty, *sa)) == a);
+    CHECK(items_of(*set_difference(*sa, *empty)) == a);
+  }
+}
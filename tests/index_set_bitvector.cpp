@@ -0,0 +1,67 @@
+/// @file index_set_bitvector.cpp
+/// @brief Testing Index_set_bitvector class.
+#include "testing_head.hpp"
+#include "../source/index_set_bitvector.hpp"
+#include <ogxx/stl_iterator.hpp>
+
+#include <vector>
+
+
+TEST_SUITE("Index_set_bitvector")
+{
+  TEST_CASE("insert, erase, iterate")
+  {
+    Scalar_index const items[] { 3, 0, 64, 63, 200, 3 };
+    Index_set_bitvector set(new_stl_iterator(items));
+    CHECK(set.size() == 5);
+    CHECK(set.contains(63));
+    CHECK(set.contains(64));
+    CHECK(!set.contains(65));
+    CHECK(!set.contains(-1));
+    CHECK(!set.contains(100000));
+
+    CHECK(set.insert(129));
+    CHECK(!set.insert(129));
+    CHECK(set.erase(0));
+    CHECK(!set.erase(0));
+    CHECK(!set.erase(5000));
+
+    std::vector<Scalar_index> result;
+    auto it = set.iterate();
+    for (Scalar_index i; it->next(i);)
+      result.push_back(i);
+    CHECK(result == std::vector<Scalar_index>{3, 63, 64, 129, 200});
+
+    Scalar_index batch[3];
+    auto handle = set.iterate_handle();
+    CHECK(handle->next_batch(batch) == 3);
+    CHECK(batch[2] == 64);
+    CHECK(handle->next_batch(batch) == 2);
+    CHECK(batch[1] == 200);
+    CHECK(handle->next_batch(batch) == 0);
+  }
+
+  TEST_CASE("ranges and words")
+  {
+    Index_set_bitvector set;
+    CHECK(set.is_empty());
+    CHECK(set.insert_range(10, 300) == 290);
+    CHECK(set.insert_range(0, 20) == 10);
+    CHECK(set.size() == 300);
+    CHECK(set.words().size() == 5);
+    CHECK(set.words()[1] == ~Index_set_bitvector::Word{});
+
+    CHECK(set.erase_range(64, 128) == 64);
+    CHECK(set.erase_range(250, 1000) == 50);
+    CHECK(set.size() == 186);
+    CHECK(!set.contains(64));
+    CHECK(set.contains(63));
+    CHECK(set.contains(128));
+    CHECK(!set.contains(250));
+
+    set.words()[0] = 0;
+    CHECK(set.size() == 122);
+    CHECK(set.erase_range(0, 1000) == 122);
+    CHECK(set.is_empty());
+  }
+}
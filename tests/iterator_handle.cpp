@@ -0,0 +1,68 @@
+/// @file tests/iterator_handle.cpp
+/// @brief Testing Basic_iterator_handle and in-place neighbor iteration.
+/// @author Kuvshinov D.R. kuvshinovdr at yandex.ru
+#include "testing_head.hpp"
+#include <ogxx/iterator_handle.hpp>
+#include <ogxx/iterator_algorithms.hpp>
+#include <ogxx/stl_iterator.hpp>
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/edge_list.hpp>
+
+#include <vector>
+
+
+TEST_SUITE("Basic_iterator_handle")
+{
+  TEST_CASE("in place and on the heap")
+  {
+    std::vector<Int> const v{ 1, 2, 3, 4 };
+
+    Int_iterator_handle h = make_stl_iterator_handle(v);
+    CHECK(h);
+    CHECK(h.is_in_place());
+
+    Int item = 0;
+    CHECK(h->next(item));
+    CHECK(item == 1);
+
+    auto moved = std::move(h);
+    CHECK(!h);
+    CHECK(moved.is_in_place());
+    CHECK(moved->next(item));
+    CHECK(item == 2);
+
+    Int_iterator_handle from_uptr = new_stl_iterator(v);
+    CHECK(from_uptr);
+    CHECK(!from_uptr.is_in_place());
+
+    Basic_iterator_handle<Int, 8> tiny = std::move(moved);
+    CHECK(!tiny.is_in_place());
+    CHECK(tiny->next(item));
+    CHECK(item == 3);
+
+    tiny.reset();
+    CHECK(!tiny);
+  }
+
+  TEST_CASE("conversion to Basic_iterator_uptr")
+  {
+    std::vector<Int> const v{ 5, 6, 7 };
+    Int_iterator_uptr p = make_stl_iterator_handle(v);
+    CHECK(equal(std::move(p), new_stl_iterator(v)));
+  }
+
+  TEST_CASE("neighbors are iterated in place")
+  {
+    auto el = new_edge_list_vector({ {0, 1}, {1, 2}, {0, 2}, {2, 0} });
+    auto gv = directed::graph_view(*el);
+
+    auto neighbors = gv->iterate_neighbors(0);
+    CHECK(neighbors.is_in_place());
+
+    Vertex_index const ref[]{ 1, 2 };
+    CHECK(equal(Index_iterator_uptr(std::move(neighbors)), new_stl_iterator(ref)));
+
+    auto adj = new_adjacency_sortedvector(new_stl_iterator(ref));
+    CHECK(adj->iterate_handle().is_in_place());
+  }
+}
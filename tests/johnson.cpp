@@ -0,0 +1,115 @@
+/// @file johnson.cpp
+/// @brief Testing Johnson's algorithm and all pairs shortest paths.
+#include "testing_head.hpp"
+#include <ogxx/johnson.hpp>
+#include <ogxx/floyd_warshall.hpp>
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/edge_list.hpp>
+#include <ogxx/stl_iterator.hpp>
+
+#include <random>
+#include <vector>
+
+
+TEST_SUITE("Johnson")
+{
+  TEST_CASE("negative weights")
+  {
+    std::vector<Vertex_pair> const arcs { {0, 1}, {1, 2}, {2, 0}, {0, 3}, {3, 2}, {2, 4} };
+    auto const al = new_adjacency_list_csr(new_stl_iterator(arcs), 6);
+    auto const gv = directed::graph_view(*al);
+
+    auto weights = new_dense_st_matrix<Int>({ 6, 6 });
+    weights->set(0, 1, 4);
+    weights->set(1, 2, -2);
+    weights->set(2, 0, 3);
+    weights->set(0, 3, 1);
+    weights->set(3, 2, -1);
+    weights->set(2, 4, 7);
+
+    Thread_pool pool(2);
+    auto const d = johnson(*gv, *weights, pool);
+    CHECK(d->get(0, 2) == 0);
+    CHECK(d->get(1, 0) == 1);
+    CHECK(d->get(3, 4) == 6);
+    CHECK(d->get(4, 0) == int_infinity);
+    CHECK(d->get(5, 5) == 0);
+    CHECK(d->get(5, 0) == int_infinity);
+
+    auto const chosen = all_pairs_shortest_paths(*gv, *weights, pool);
+    for (Scalar_index i = 0; i < 6; ++i)
+      for (Scalar_index j = 0; j < 6; ++j)
+        CHECK(chosen->get(i, j) == d->get(i, j));
+
+    weights->set(3, 2, -6);
+    CHECK_THROWS_AS((void)johnson(*gv, *weights, pool), std::invalid_argument);
+
+    auto const small = new_dense_st_matrix<Int>({ 5, 5 });
+    CHECK_THROWS_AS((void)johnson(*gv, *small, pool), std::invalid_argument);
+  }
+
+  TEST_CASE("matches Floyd-Warshall on random graphs")
+  {
+    Scalar_size const n = 300;
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> weight(1, 50), vertex(0, n - 1);
+
+    std::vector<Vertex_pair> arcs;
+    auto weights = new_dense_st_matrix<Float>({ n, n });
+    weights->fill(infinity);
+    auto lengths = new_dense_st_matrix<Float>({ n, n });
+    lengths->fill(infinity);
+    for (Vertex_index u = 0; u < n; ++u)
+    {
+      lengths->set(u, u, 0.);
+      for (int k = 0; k < 3; ++k)
+      {
+        auto const v = vertex(rng);
+        if (v == u)
+          continue;
+
+        // Repeated arcs get the last weight in both the matrices.
+        auto const w = Float(weight(rng)) / 2;
+        arcs.emplace_back(u, v);
+        weights->set(u, v, w);
+        lengths->set(u, v, w);
+      }
+    }
+
+    auto const al = new_adjacency_list_csr(new_stl_iterator(arcs), n);
+    auto const gv = directed::graph_view(*al);
+
+    Thread_pool pool(3);
+    auto const d        = johnson(*gv, *weights, pool);
+    auto const expected = floyd_warshall_only_matrix(*lengths);
+
+    Scalar_size mismatches = 0;
+    for (Scalar_index i = 0; i < n; ++i)
+      for (Scalar_index j = 0; j < n; ++j)
+        mismatches += d->get(i, j) != expected->get(i, j);
+    CHECK(mismatches == 0);
+  }
+
+  TEST_CASE("undirected graph and density choice")
+  {
+    std::vector<Vertex_pair> const edges { {0, 1}, {1, 2}, {2, 3} };
+    auto const el = new_edge_list_vector({ {0, 1}, {1, 2}, {2, 3} });
+    auto const al = new_adjacency_list_csr(*undirected::graph_view(*new_adjacency_list_csr(*directed::graph_view(*el))));
+    auto const gv = undirected::graph_view(*al);
+
+    auto weights = new_dense_st_matrix<Int>({ 4, 4 });
+    for (auto [u, v]: edges)
+    {
+      weights->set(u, v, Int(u + v));
+      weights->set(v, u, Int(u + v));
+    }
+
+    auto const d = johnson(*gv, *weights, default_thread_pool());
+    CHECK(d->get(3, 0) == 1 + 3 + 5);
+    CHECK(d->get(0, 3) == 1 + 3 + 5);
+
+    CHECK(!prefer_johnson(1000, 2000));
+    CHECK(prefer_johnson(4000, 12000));
+    CHECK(!prefer_johnson(4000, 400000));
+  }
+}
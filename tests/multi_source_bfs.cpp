@@ -0,0 +1,134 @@
+/// @file multi_source_bfs.cpp
+/// @brief Testing multi-source bit-parallel BFS.
+#include "testing_head.hpp"
+#include <ogxx/multi_source_bfs.hpp>
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/edge_list.hpp>
+
+#include <deque>
+#include <numeric>
+#include <random>
+#include <vector>
+
+
+TEST_SUITE("multi_source_bfs")
+{
+  /// Plain queue-based hop counts.
+  auto hop_counts(Graph_view const& graph, Vertex_index source)
+    -> std::vector<Int>
+  {
+    std::vector<Int> hops(graph.vertex_count(), int_infinity);
+    std::deque<Vertex_index> queue { source };
+    hops[source] = 0;
+    while (!queue.empty())
+    {
+      auto const u = queue.front();
+      queue.pop_front();
+      auto neighbors = graph.iterate_neighbors(u);
+      for (Vertex_index v; neighbors->next(v);)
+        if (hops[v] == int_infinity)
+        {
+          hops[v] = hops[u] + 1;
+          queue.push_back(v);
+        }
+    }
+
+    return hops;
+  }
+
+  TEST_CASE("small graph and summaries")
+  {
+    // 0 -> 1 -> 2 -> 3, 0 -> 2, 4 -> 0
+    auto const el = new_edge_list_vector({ {0, 1}, {1, 2}, {2, 3}, {0, 2}, {4, 0} });
+    auto const gv = directed::graph_view(*el);
+
+    Thread_pool pool(2);
+    std::vector<Vertex_index> const sources { 0, 4, 3, 0 };
+    auto const d = multi_source_bfs(*gv, sources, pool);
+    REQUIRE(d->shape().rows == 4);
+    CHECK(d->get(0, 3) == 2);
+    CHECK(d->get(1, 3) == 3);
+    CHECK(d->get(1, 4) == 0);
+    CHECK(d->get(2, 0) == int_infinity);
+    CHECK(d->get(3, 1) == 1);
+
+    auto const summaries = multi_source_bfs_summary(*gv, sources, pool);
+    CHECK(summaries[0].reached == 4);
+    CHECK(summaries[0].distance_sum == 1 + 1 + 2);
+    CHECK(summaries[1].eccentricity == 3);
+    CHECK(summaries[2].reached == 1);
+    CHECK(summaries[2].closeness() == 0.0);
+    CHECK(summaries[0].closeness() == 0.75);
+
+    auto small = new_dense_st_matrix<Int>({ 3, 5 });
+    CHECK_THROWS_AS(multi_source_bfs(*gv, sources, *small, pool), std::invalid_argument);
+    std::vector<Vertex_index> const bad { 1, 5 };
+    CHECK_THROWS_AS((void)multi_source_bfs(*gv, bad, pool), std::out_of_range);
+  }
+
+  TEST_CASE("narrow and wide batches match single searches")
+  {
+    Scalar_size const n = 1200;
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<Vertex_index> vertex(0, n - 1);
+    auto const el = new_edge_list_vector();
+    for (Scalar_index i = 0; i < 2 * n; ++i)
+      el->put({ vertex(rng), vertex(rng) });
+
+    auto const al = new_adjacency_list_csr(*undirected::graph_view(*new_adjacency_list_csr(*directed::graph_view(*el))));
+    auto const gv = undirected::graph_view(*al);
+
+    std::vector<Vertex_index> all(n);
+    std::iota(all.begin(), all.end(), 0);
+
+    Thread_pool pool(2);
+    for (auto count: { Scalar_size(70), n })
+    {
+      auto const sources = std::span<Vertex_index const>(all).first(count);
+      auto const d = multi_source_bfs(*gv, sources, pool);
+      auto const summaries = multi_source_bfs_summary(*gv, sources, pool);
+      for (Scalar_index row = 0; row < count; row += 13)
+      {
+        auto const expected = hop_counts(*gv, sources[row]);
+        Scalar_size reached = 0;
+        for (Vertex_index v = 0; v < n; ++v)
+        {
+          CHECK(d->get(row, v) == expected[v]);
+          reached += expected[v] != int_infinity;
+        }
+
+        CHECK(summaries[row].reached == reached);
+      }
+    }
+  }
+
+  TEST_CASE("all pairs hop distances")
+  {
+    Scalar_size const n = 700;
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<Vertex_index> vertex(0, n - 1);
+    auto const el = new_edge_list_vector();
+    for (Scalar_index i = 0; i < 3 * n; ++i)
+      el->put({ vertex(rng), vertex(rng) });
+
+    auto const directed_gv = directed::graph_view(*el);
+    auto const al          = new_adjacency_list_csr(*directed_gv);
+    auto const csr_gv      = directed::graph_view(*al);
+    auto const symmetric   = new_adjacency_list_csr(*undirected::graph_view(*al));
+    auto const undirected_gv = undirected::graph_view(*symmetric);
+
+    Thread_pool pool(3);
+    for (auto graph: { directed_gv.get(), csr_gv.get(), undirected_gv.get() })
+    {
+      auto const d = all_pairs_hop_distances(*graph, pool);
+      REQUIRE(d->shape().rows == n);
+      REQUIRE(d->shape().cols == n);
+      for (Vertex_index from = 0; from < n; from += 37)
+      {
+        auto const expected = hop_counts(*graph, from);
+        for (Vertex_index to = 0; to < n; ++to)
+          CHECK(d->get(from, to) == expected[to]);
+      }
+    }
+  }
+}
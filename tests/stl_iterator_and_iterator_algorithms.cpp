@@ -214,5 +214,46 @@ TEST_SUITE("stl_iterator and iterator_algorithms")
     CHECK_THROWS_AS(ogxx::inner_product(move(null), new_stl_iterator(data1), 0), std::invalid_argument);
     CHECK_THROWS_AS(ogxx::inner_product(new_stl_iterator(data1), move(null), 0), std::invalid_argument);
   }
+
+  TEST_CASE("next_batch")
+  {
+    int const data[]{ 1, 2, 3, 4, 5, 6, 7 };
+    int batch[3]{};
+
+    auto p = new_stl_iterator(data);
+    CHECK(p->next_batch(batch) == 3);
+    CHECK((batch[0] == 1 && batch[1] == 2 && batch[2] == 3));
+
+    int item = 0;
+    CHECK(p->next(item));
+    CHECK(item == 4);
+
+    CHECK(p->next_batch(batch) == 3);
+    CHECK((batch[0] == 5 && batch[1] == 6 && batch[2] == 7));
+    CHECK(p->next_batch(batch) == 0);
+
+    unsigned const words[]{ 0xF0F0F0F0u, 0x1u };
+    bool bits[40]{};
+    auto b = new_dense_bit_iterator(words, 2, 34);
+    CHECK(b->next_batch(bits) == 32);
+    for (int i = 0; i < 32; ++i)
+      CHECK(bits[i] == ((words[(i + 2) / 32] >> ((i + 2) % 32) & 1) == 1));
+  }
+
+  TEST_CASE("algorithms over several batches")
+  {
+    std::vector<int> v(3 * iterator_batch_size + 5);
+    for (size_t i = 0; i < v.size(); ++i)
+      v[i] = static_cast<int>(i);
+
+    auto const n = static_cast<int>(v.size());
+    CHECK(accumulate(new_stl_iterator(v), 0) == n * (n - 1) / 2);
+    CHECK(count_if(new_stl_iterator(v), [](int x) { return x % 2 == 0; }) == (n + 1) / 2);
+    CHECK(any_of(new_stl_iterator(v), [=](int x) { return x == n - 1; }));
+    CHECK(all_of(new_stl_iterator(v), [=](int x) { return x < n; }));
+    CHECK(equal(new_stl_iterator(v), new_stl_iterator(v)));
+    CHECK(!equal(new_stl_iterator(v), new_stl_iterator(v.begin(), v.end() - 1)));
+  }
+
   // TODO: TEST_CASE     iterator_algorithms.hpp.
 }
@@ -0,0 +1,122 @@
+/// @file strongly_connected_components.cpp
+/// @brief Testing strongly connected components and condensation.
+#include "testing_head.hpp"
+#include <ogxx/strongly_connected_components.hpp>
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/edge_list.hpp>
+
+#include <random>
+#include <vector>
+
+
+TEST_SUITE("strongly_connected_components")
+{
+  /// Check that two labelings define the same partition.
+  auto same_partition(Strong_components const& a, Strong_components const& b)
+    -> bool
+  {
+    if (a.count != b.count || a.labels.size() != b.labels.size())
+      return false;
+
+    std::vector<Vertex_index> a_to_b(a.count, npos), b_to_a(b.count, npos);
+    for (std::size_t v = 0; v < a.labels.size(); ++v)
+    {
+      auto const la = a.labels[v], lb = b.labels[v];
+      if (a_to_b[la] == npos && b_to_a[lb] == npos)
+      {
+        a_to_b[la] = lb;
+        b_to_a[lb] = la;
+      }
+      else if (a_to_b[la] != lb || b_to_a[lb] != la)
+        return false;
+    }
+
+    return true;
+  }
+
+  TEST_CASE("small graph and condensation")
+  {
+    // {0, 1, 2} -> {3, 4} -> {6}, {5} alone.
+    auto const el = new_edge_list_vector({ {0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 3}, {4, 6}, {1, 4}, {5, 5} });
+    auto const gv = directed::graph_view(*el);
+
+    auto const scc = strongly_connected_components(*gv);
+    REQUIRE(scc.count == 4);
+    CHECK(scc.labels[0] == scc.labels[1]);
+    CHECK(scc.labels[1] == scc.labels[2]);
+    CHECK(scc.labels[3] == scc.labels[4]);
+    CHECK(scc.labels[6] < scc.labels[3]);
+    CHECK(scc.labels[3] < scc.labels[0]);
+
+    Thread_pool pool(2);
+    CHECK(same_partition(strongly_connected_components(*gv, pool), scc));
+
+    auto const dag_el = new_edge_list_vector();
+    auto const dag    = directed::graph_view(*dag_el);
+    CHECK(condensation(*gv, scc, *dag) == 2);
+    CHECK(dag->are_connected(scc.labels[0], scc.labels[3]));
+    CHECK(dag->are_connected(scc.labels[3], scc.labels[6]));
+
+    Strong_components const short_labels { { 0, 0 }, 1 };
+    CHECK_THROWS_AS((void)condensation(*gv, short_labels, *dag), std::invalid_argument);
+  }
+
+  TEST_CASE("random graphs: serial and parallel agree, condensation is acyclic")
+  {
+    Scalar_size const n = 8000;
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<Vertex_index> vertex(0, n - 1);
+    for (Scalar_size arcs: { n / 2, n, 2 * n })
+    {
+      auto const el = new_edge_list_vector();
+      for (Scalar_index i = 0; i < arcs; ++i)
+        el->put({ vertex(rng), vertex(rng) });
+      el->put({ n - 1, 0 });
+
+      auto const edge_gv = directed::graph_view(*el);
+      auto const csr_al  = new_adjacency_list_csr(*edge_gv);
+      auto const bi_al   = new_adjacency_list_bidirectional_csr(*edge_gv);
+      auto const csr_gv  = directed::graph_view(*csr_al);
+      auto const bi_gv   = directed::graph_view(*bi_al);
+
+      auto const scc = strongly_connected_components(*edge_gv);
+      CHECK(same_partition(strongly_connected_components(*csr_gv), scc));
+
+      // Arcs between components go from greater labels to lesser ones.
+      auto all_arcs = edge_gv->iterate_edges();
+      for (Vertex_pair arc; all_arcs->next(arc);)
+        CHECK(scc.labels[arc.first] >= scc.labels[arc.second]);
+
+      Thread_pool pool(3);
+      for (auto graph: { edge_gv.get(), csr_gv.get(), bi_gv.get() })
+        CHECK(same_partition(strongly_connected_components(*graph, pool), scc));
+
+      auto const dag_el = new_edge_list_vector();
+      auto const dag    = directed::graph_view(*dag_el);
+      auto const dag_arcs = condensation(*csr_gv, scc, *dag);
+      CHECK(dag_arcs == dag_el->size());
+      auto const dag_scc = strongly_connected_components(*dag);
+      CHECK(dag_scc.count == dag->vertex_count());
+    }
+  }
+
+  TEST_CASE("deep graphs need no recursion")
+  {
+    // A path of n vertices closed into a cycle and a long tail of single-vertex components.
+    Scalar_size const n = 300000;
+    auto const el = new_edge_list_vector();
+    for (Vertex_index v = 0; v + 1 < n; ++v)
+      el->put({ v, v + 1 });
+    el->put({ n / 2, 0 });
+
+    auto const al = new_adjacency_list_csr(*directed::graph_view(*el));
+    auto const gv = directed::graph_view(*al);
+    auto const scc = strongly_connected_components(*gv);
+    CHECK(scc.count == n - n / 2);
+    CHECK(scc.labels[0] == scc.labels[n / 2]);
+    CHECK(scc.labels[n - 1] == 0);
+
+    Thread_pool pool(2);
+    CHECK(same_partition(strongly_connected_components(*gv, pool), scc));
+  }
+}
@@ -0,0 +1,69 @@
+/// @file thread_pool.cpp
+/// @brief Testing Thread_pool class.
+#include "testing_head.hpp"
+#include <ogxx/thread_pool.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+
+TEST_SUITE("Thread_pool")
+{
+  TEST_CASE("parallel_for visits each index once")
+  {
+    Thread_pool pool(4);
+    CHECK(pool.thread_count() == 4);
+
+    for (int round = 0; round < 20; ++round)
+    {
+      std::vector<std::atomic<int>> visits(1000);
+      pool.parallel_for(1000, [&](Scalar_index i) { ++visits[i]; });
+
+      Scalar_size wrong = 0;
+      for (auto& v: visits)
+        wrong += v != 1;
+      CHECK(wrong == 0);
+    }
+
+    bool called = false;
+    pool.parallel_for(0, [&](Scalar_index) { called = true; });
+    CHECK(!called);
+  }
+
+  TEST_CASE("nested loops and exceptions")
+  {
+    Thread_pool pool(3);
+    std::atomic<Scalar_size> sum = 0;
+    pool.parallel_for(10, [&](Scalar_index i)
+      {
+        pool.parallel_for(10, [&](Scalar_index j) { sum += i * 10 + j; });
+      });
+    CHECK(sum == 99 * 100 / 2);
+
+    CHECK_THROWS_AS(pool.parallel_for(100, [](Scalar_index i)
+      {
+        if (i == 42)
+          throw std::runtime_error("task failed");
+      }), std::runtime_error);
+
+    // The pool is still usable.
+    sum = 0;
+    pool.parallel_for(100, [&](Scalar_index i) { sum += i; });
+    CHECK(sum == 4950);
+  }
+
+  TEST_CASE("set_thread_count")
+  {
+    Thread_pool pool(1);
+    CHECK(pool.thread_count() == 1);
+    pool.set_thread_count(5);
+    CHECK(pool.thread_count() == 5);
+
+    std::atomic<Scalar_size> sum = 0;
+    pool.parallel_for(100, [&](Scalar_index i) { sum += i; });
+    CHECK(sum == 4950);
+
+    CHECK(default_thread_pool().thread_count() >= 1);
+  }
+}
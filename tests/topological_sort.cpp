@@ -0,0 +1,98 @@
+/// @file topological_sort.cpp
+/// @brief Testing topological levels and cycle witnesses.
+#include "testing_head.hpp"
+#include <ogxx/topological_sort.hpp>
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/edge_list.hpp>
+#include <ogxx/stl_iterator.hpp>
+#include <ogxx/subgraph_checks.hpp>
+
+#include <random>
+#include <vector>
+
+
+TEST_SUITE("topological_sort")
+{
+  TEST_CASE("small graphs")
+  {
+    // 0 -> 2, 1 -> 2, 2 -> 3, 0 -> 3, 4 -> 3
+    auto const el = new_edge_list_vector({ {0, 2}, {1, 2}, {2, 3}, {0, 3}, {4, 3} });
+    auto const gv = directed::graph_view(*el);
+
+    Thread_pool pool(2);
+    auto const levels = topological_levels(*gv, pool);
+    CHECK(levels.is_acyclic());
+    REQUIRE(levels.level_count() == 3);
+    CHECK(std::vector<Vertex_index>(levels.level(0).begin(), levels.level(0).end()) == std::vector<Vertex_index>{ 0, 1, 4 });
+    CHECK(std::vector<Vertex_index>(levels.level(1).begin(), levels.level(1).end()) == std::vector<Vertex_index>{ 2 });
+    CHECK(std::vector<Vertex_index>(levels.level(2).begin(), levels.level(2).end()) == std::vector<Vertex_index>{ 3 });
+    CHECK(find_cycle(*gv).empty());
+
+    // 3 -> 5 -> 6 -> 3 closes a cycle, 6 -> 7 is reachable from it.
+    auto const cyclic_el = new_edge_list_vector({ {0, 2}, {1, 2}, {2, 3}, {3, 5}, {5, 6}, {6, 3}, {6, 7}, {1, 8} });
+    auto const cyclic = directed::graph_view(*cyclic_el);
+    auto const partial = topological_levels(*cyclic, pool);
+    CHECK(!partial.is_acyclic());
+    CHECK(partial.unordered == 4);
+    CHECK(partial.order.size() == 5);
+
+    auto const cycle = find_cycle(*cyclic);
+    CHECK(cycle.size() == 3);
+    CHECK(is_loop(*cyclic, new_stl_iterator(cycle)));
+
+    auto const self_loop_el = new_edge_list_vector({ {0, 1}, {1, 1} });
+    auto const self_loop = directed::graph_view(*self_loop_el);
+    CHECK(find_cycle(*self_loop) == std::vector<Vertex_index>{ 1 });
+    CHECK(topological_levels(*self_loop, pool).unordered == 1);
+  }
+
+  TEST_CASE("random DAGs and cycles")
+  {
+    Scalar_size const n = 20000;
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<Vertex_index> vertex(0, n - 1);
+    auto const el = new_edge_list_vector();
+    for (Scalar_index i = 0; i < 3 * n; ++i)
+    {
+      auto u = vertex(rng), v = vertex(rng);
+      if (u != v)
+        el->put({ min(u, v), max(u, v) });
+    }
+    el->put({ 0, n - 1 });
+
+    auto const al = new_adjacency_list_csr(*directed::graph_view(*el));
+    auto const gv = directed::graph_view(*al);
+
+    Thread_pool pool(3);
+    auto const levels = topological_levels(*gv, pool);
+    REQUIRE(levels.is_acyclic());
+    REQUIRE(levels.order.size() == n);
+
+    std::vector<Scalar_index> level_of(n, npos);
+    for (Scalar_index k = 0; k < levels.level_count(); ++k)
+      for (auto v: levels.level(k))
+        level_of[v] = k;
+
+    // Each arc goes up, each vertex above level 0 has an in-arc from the level just below.
+    std::vector<bool> has_previous(n, false);
+    auto arcs = gv->iterate_edges();
+    for (Vertex_pair arc; arcs->next(arc);)
+    {
+      CHECK(level_of[arc.first] < level_of[arc.second]);
+      if (level_of[arc.first] + 1 == level_of[arc.second])
+        has_previous[arc.second] = true;
+    }
+
+    for (Vertex_index v = 0; v < n; ++v)
+      CHECK((level_of[v] == 0 || has_previous[v]));
+    CHECK(find_cycle(*gv).empty());
+
+    el->put({ n - 1, 0 });
+    auto const cyclic_al = new_adjacency_list_csr(*directed::graph_view(*el));
+    auto const cyclic    = directed::graph_view(*cyclic_al);
+    CHECK(!topological_levels(*cyclic, pool).is_acyclic());
+    auto const cycle = find_cycle(*cyclic);
+    REQUIRE(!cycle.empty());
+    CHECK(is_loop(*cyclic, new_stl_iterator(cycle)));
+  }
+}
@@ -0,0 +1,84 @@
+/// @file triangle_counting.cpp
+/// @brief Testing triangle counting and clustering coefficients.
+#include "testing_head.hpp"
+#include <ogxx/triangle_counting.hpp>
+#include <ogxx/adjacency_list.hpp>
+#include <ogxx/edge_list.hpp>
+
+#include <random>
+#include <vector>
+
+
+TEST_SUITE("triangle_counting")
+{
+  TEST_CASE("small graphs")
+  {
+    Thread_pool pool(2);
+
+    // Complete graph on 5 vertices, given by one arc per edge.
+    auto const complete_el = new_edge_list_vector();
+    for (Vertex_index u = 0; u < 5; ++u)
+      for (Vertex_index v = u + 1; v < 5; ++v)
+        complete_el->put({ v, u });
+    auto const complete = count_triangles(*directed::graph_view(*complete_el), pool);
+    CHECK(complete.total == 10);
+    CHECK(complete.transitivity == 1.0);
+    CHECK(complete.per_vertex == std::vector<Scalar_size>(5, 6));
+    CHECK(complete.clustering == std::vector<Float>(5, 1.0));
+
+    // Triangle 0 1 2 with a pendant vertex 3 at 2, a self-loop and a repeated arc in both directions.
+    auto const el = new_edge_list_vector({ {0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 3}, {1, 0} });
+    auto const counts = count_triangles(*directed::graph_view(*el), pool);
+    CHECK(counts.total == 1);
+    CHECK(counts.per_vertex == std::vector<Scalar_size>{ 1, 1, 1, 0 });
+    CHECK(counts.clustering == std::vector<Float>{ 1.0, 1.0, 1.0 / 3, 0.0 });
+    CHECK(counts.transitivity == 3.0 / 5);
+  }
+
+  TEST_CASE("matches brute force")
+  {
+    Scalar_size const n = 300;
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<Vertex_index> vertex(0, n - 1);
+    auto const el = new_edge_list_vector();
+    for (Scalar_index i = 0; i < 6 * n; ++i)
+      el->put({ vertex(rng), vertex(rng) });
+    // Hubs make the neighbor list lengths differ much.
+    for (Vertex_index hub: { 1, 2, 3 })
+      for (Vertex_index v = 0; v < n; v += hub + 1)
+        el->put({ hub, v });
+
+    auto const directed_al   = new_adjacency_list_csr(*directed::graph_view(*el));
+    auto const directed_gv   = directed::graph_view(*directed_al);
+    auto const undirected_al = new_adjacency_list_csr(*undirected::graph_view(*directed_al));
+    auto const undirected_gv = undirected::graph_view(*undirected_al);
+
+    Thread_pool pool(3);
+    for (auto graph: { directed_gv.get(), undirected_gv.get() })
+    {
+      auto const linked = [graph](Vertex_index u, Vertex_index v)
+        {
+          return graph->are_connected(u, v) || graph->are_connected(v, u);
+        };
+
+      Scalar_size total = 0;
+      std::vector<Scalar_size> per_vertex(n, 0);
+      for (Vertex_index u = 0; u < n; ++u)
+        for (Vertex_index v = u + 1; v < n; ++v)
+          if (linked(u, v))
+            for (Vertex_index w = v + 1; w < n; ++w)
+              if (linked(u, w) && linked(v, w))
+              {
+                ++total;
+                ++per_vertex[u];
+                ++per_vertex[v];
+                ++per_vertex[w];
+              }
+
+      auto const counts = count_triangles(*graph, pool);
+      CHECK(counts.total == total);
+      CHECK(counts.per_vertex == per_vertex);
+      CHECK(counts.clustering.size() == n);
+    }
+  }
+}
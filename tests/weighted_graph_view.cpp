@@ -0,0 +1,103 @@
+/// @file weighted_graph_view.cpp
+/// @brief Testing weighted graph views and their adapters.
+#include "testing_head.hpp"
+#include <ogxx/weighted_graph_view.hpp>
+#include <ogxx/johnson.hpp>
+
+#include <vector>
+
+
+TEST_SUITE("Weighted_graph_view")
+{
+  TEST_CASE("edge list")
+  {
+    auto const el = new_edge_list_vector({ {0, 2}, {0, 1}, {2, 3}, {0, 2} });
+    std::vector<Int> const weights { 5, 7, 1, 3 };
+
+    auto const di = new_weighted_graph_view(*el, weights, true);
+    CHECK(di->is_directed());
+    CHECK(di->vertex_count() == 4);
+    CHECK(di->edge_count() == 3);
+
+    auto const [vertices, ws] = di->weighted_neighbors(0);
+    REQUIRE(vertices.size() == 2);
+    CHECK(vertices[0] == 1);
+    CHECK(ws[0] == 7);
+    CHECK(vertices[1] == 2);
+    CHECK(ws[1] == 3); // the least of the repeated edge
+    CHECK(di->weight(2, 3) == 1);
+    CHECK(di->weight(3, 2) == int_infinity);
+    CHECK(di->weight(7, 0) == int_infinity);
+    CHECK(di->weighted_neighbors(-1).size() == 0);
+
+    auto const un = new_weighted_graph_view(*el, weights, false, 6);
+    CHECK(!un->is_directed());
+    CHECK(un->vertex_count() == 6);
+    CHECK(un->edge_count() == 3);
+    CHECK(un->weight(3, 2) == 1);
+    CHECK(un->weight(1, 0) == 7);
+    CHECK(un->are_connected(2, 0));
+
+    auto const csr = csr_view(*un);
+    REQUIRE(csr);
+    CHECK(csr.targets.size() == 6);
+
+    std::vector<Int> const short_weights { 1, 2 };
+    CHECK_THROWS_AS((void)new_weighted_graph_view(*el, short_weights, true), std::invalid_argument);
+  }
+
+  TEST_CASE("adjacency list with a weight matrix or a function")
+  {
+    auto const al = new_adjacency_list_vector();
+    auto const gv = directed::graph_view(*al);
+    gv->set_vertex_count(4);
+    for (auto [from, to]: { Vertex_pair{0, 1}, Vertex_pair{1, 2}, Vertex_pair{2, 0}, Vertex_pair{1, 3} })
+      gv->connect(from, to);
+
+    auto weights = new_dense_st_matrix<Float>({ 4, 4 });
+    weights->fill(infinity);
+    weights->set(0, 1, 0.5);
+    weights->set(1, 2, 1.5);
+    weights->set(2, 0, 2.5);
+
+    auto const wv = new_weighted_graph_view(*gv, *weights);
+    CHECK(wv->edge_count() == 3); // 1 -> 3 weighs infinity
+    CHECK(wv->weight(1, 2) == 1.5);
+    CHECK(wv->weight(1, 3) == infinity);
+    CHECK(!wv->are_connected(1, 3));
+
+    auto const fv = new_weighted_graph_view(*gv, [](Vertex_index u, Vertex_index v) { return Int(10 * u + v); });
+    static_assert(std::is_same_v<decltype(fv), Int_weighted_graph_view_uptr const>);
+    CHECK(fv->edge_count() == 4);
+    CHECK(fv->weight(1, 3) == 13);
+    CHECK(fv->weight(2, 0) == 20);
+
+    auto const small = new_dense_st_matrix<Float>({ 3, 3 });
+    CHECK_THROWS_AS((void)new_weighted_graph_view(*gv, *small), std::invalid_argument);
+  }
+
+  TEST_CASE("dense weighted adjacency")
+  {
+    auto weights = new_dense_st_matrix<Int>({ 3, 3 });
+    weights->fill(int_infinity);
+    weights->set(0, 0, 0);
+    weights->set(0, 1, 4);
+    weights->set(1, 2, -1);
+    weights->set(2, 1, 6);
+
+    auto const di = new_weighted_graph_view(*weights);
+    CHECK(di->edge_count() == 3);
+    CHECK(!di->are_connected(0, 0));
+    CHECK(di->weight(2, 1) == 6);
+
+    auto const un = new_weighted_graph_view(*weights, false);
+    CHECK(un->edge_count() == 2);
+    CHECK(un->weight(1, 0) == 4);
+    CHECK(un->weight(2, 1) == -1); // the entry above the diagonal
+
+    Thread_pool pool(1);
+    auto const d = johnson(*di, pool);
+    CHECK(d->get(0, 2) == 3);
+    CHECK(d->get(2, 0) == int_infinity);
+  }
+}